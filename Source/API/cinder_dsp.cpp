@@ -0,0 +1,327 @@
+#include "cinder_dsp.h"
+#include "SpilloverEngine.h"
+#include "ShimmerReverbBatch.h"
+#include "FlushDenormals.h"
+#include <algorithm>
+#include <memory>
+#include <new>
+#include <vector>
+
+static_assert(CINDER_PARAM_COUNT == SpilloverEngine::numParams, "cinder_param must mirror BasicCinderEngine::Param");
+
+struct cinder_dsp
+{
+    SpilloverEngine engine;
+    int maxBlockSize = 0;
+};
+
+cinder_dsp* cinder_dsp_create(void)
+{
+    return new (std::nothrow) cinder_dsp();
+}
+
+cinder_result cinder_dsp_prepare(cinder_dsp* dsp, double sample_rate, int max_block_size)
+{
+    if (dsp == nullptr || ! (sample_rate > 0.0) || max_block_size <= 0)
+        return CINDER_ERROR_INVALID_ARGUMENT;
+
+    // Exceptions must not cross the C boundary
+    try
+    {
+        dsp->engine.prepare(sample_rate, max_block_size);
+    }
+    catch (const std::bad_alloc&)
+    {
+        dsp->maxBlockSize = 0;
+        return CINDER_ERROR_OUT_OF_MEMORY;
+    }
+
+    dsp->maxBlockSize = max_block_size;
+    return CINDER_OK;
+}
+
+cinder_result cinder_dsp_set_param(cinder_dsp* dsp, cinder_param param, float value)
+{
+    if (dsp == nullptr || param < 0 || param >= CINDER_PARAM_COUNT)
+        return CINDER_ERROR_INVALID_ARGUMENT;
+
+    dsp->engine.setParameter(static_cast<int>(param), value);
+    return CINDER_OK;
+}
+
+float cinder_dsp_get_param(const cinder_dsp* dsp, cinder_param param)
+{
+    return dsp != nullptr ? dsp->engine.getParameter(static_cast<int>(param)) : 0.0f;
+}
+
+void cinder_dsp_reset(cinder_dsp* dsp)
+{
+    if (dsp != nullptr && dsp->maxBlockSize > 0)
+        dsp->engine.reset();
+}
+
+cinder_result cinder_dsp_process_block(cinder_dsp* dsp,
+                                       const float* in_l, const float* in_r,
+                                       float* out_l, float* out_r,
+                                       int num_samples)
+{
+    if (dsp == nullptr || in_l == nullptr || out_l == nullptr || out_r == nullptr || num_samples < 0)
+        return CINDER_ERROR_INVALID_ARGUMENT;
+    if (dsp->maxBlockSize <= 0)
+        return CINDER_ERROR_NOT_PREPARED;
+
+    if (in_r == nullptr)
+        in_r = in_l;
+
+    FlushDenormals noDenormals;
+
+    // The engine works in place on the output buffers
+    for (int pos = 0; pos < num_samples; pos += dsp->maxBlockSize)
+    {
+        const int n = std::min(dsp->maxBlockSize, num_samples - pos);
+
+        if (out_l + pos != in_l + pos)
+            std::copy(in_l + pos, in_l + pos + n, out_l + pos);
+        if (out_r + pos != in_r + pos)
+            std::copy(in_r + pos, in_r + pos + n, out_r + pos);
+
+        dsp->engine.process(out_l + pos, out_r + pos, n);
+    }
+    return CINDER_OK;
+}
+
+cinder_result cinder_dsp_set_spillover(cinder_dsp* dsp, int enabled)
+{
+    if (dsp == nullptr)
+        return CINDER_ERROR_INVALID_ARGUMENT;
+
+    dsp->engine.setSpilloverEnabled(enabled != 0);
+    return CINDER_OK;
+}
+
+cinder_result cinder_dsp_set_snapshot(cinder_dsp* dsp, int slot, const float* values)
+{
+    if (dsp == nullptr || slot < 0 || slot >= SpilloverEngine::numSnapshots || values == nullptr)
+        return CINDER_ERROR_INVALID_ARGUMENT;
+
+    dsp->engine.setSnapshot(slot, values);
+    return CINDER_OK;
+}
+
+void cinder_dsp_clear_snapshots(cinder_dsp* dsp)
+{
+    if (dsp != nullptr)
+        dsp->engine.clearSnapshots();
+}
+
+int cinder_dsp_get_recovery_count(const cinder_dsp* dsp)
+{
+    return dsp != nullptr ? dsp->engine.getRecoveryCount() : 0;
+}
+
+void cinder_dsp_destroy(cinder_dsp* dsp)
+{
+    delete dsp;
+}
+
+// --- Delay storage ---
+
+static_assert(static_cast<int>(SampleStorage::float32) == CINDER_STORAGE_FLOAT32
+              && static_cast<int>(SampleStorage::float16) == CINDER_STORAGE_FLOAT16
+              && static_cast<int>(SampleStorage::int16) == CINDER_STORAGE_INT16,
+              "cinder_storage must mirror SampleStorage");
+
+static bool isValidStorage(cinder_storage storage)
+{
+    return storage >= CINDER_STORAGE_FLOAT32 && storage <= CINDER_STORAGE_INT16;
+}
+
+cinder_result cinder_dsp_set_delay_storage(cinder_dsp* dsp, cinder_storage storage)
+{
+    if (dsp == nullptr || ! isValidStorage(storage))
+        return CINDER_ERROR_INVALID_ARGUMENT;
+
+    dsp->engine.setDelayStorage(static_cast<SampleStorage>(storage));
+    return CINDER_OK;
+}
+
+// --- Input diffusion ---
+
+static_assert(static_cast<int>(ShimmerReverb::InputDiffusion::allpass) == CINDER_DIFFUSION_ALLPASS
+              && static_cast<int>(ShimmerReverb::InputDiffusion::velvet) == CINDER_DIFFUSION_VELVET,
+              "cinder_diffusion must mirror ShimmerReverb::InputDiffusion");
+
+cinder_result cinder_dsp_set_input_diffusion(cinder_dsp* dsp, cinder_diffusion diffusion)
+{
+    if (dsp == nullptr || diffusion < CINDER_DIFFUSION_ALLPASS || diffusion > CINDER_DIFFUSION_VELVET)
+        return CINDER_ERROR_INVALID_ARGUMENT;
+
+    dsp->engine.setInputDiffusion(static_cast<ShimmerReverb::InputDiffusion>(diffusion));
+    return CINDER_OK;
+}
+
+// --- SIMD level ---
+
+static_assert(static_cast<int>(SimdLevel::generic) == CINDER_SIMD_GENERIC
+              && static_cast<int>(SimdLevel::avx2) == CINDER_SIMD_AVX2
+              && static_cast<int>(SimdLevel::avx512) == CINDER_SIMD_AVX512,
+              "cinder_simd_level must mirror SimdLevel");
+
+cinder_simd_level cinder_get_simd_level(void)
+{
+    return static_cast<cinder_simd_level>(getActiveSimdLevel());
+}
+
+cinder_result cinder_force_simd_level(cinder_simd_level level)
+{
+    return forceSimdLevel(static_cast<SimdLevel>(level)) ? CINDER_OK : CINDER_ERROR_INVALID_ARGUMENT;
+}
+
+void cinder_clear_forced_simd_level(void)
+{
+    clearForcedSimdLevel();
+}
+
+const char* cinder_simd_level_name(cinder_simd_level level)
+{
+    return getSimdLevelName(static_cast<SimdLevel>(level));
+}
+
+// --- Reverb bank ---
+
+struct cinder_bank
+{
+    using Batch = ShimmerReverbBatch;
+
+    int numInstances = 0;
+    int maxBlockSize = 0;
+    std::vector<std::unique_ptr<Batch>> groups;
+
+    // Per-lane pointers, padded to whole groups (unused lanes stay NULL)
+    std::vector<const float*> inputs;
+    std::vector<float*> outputs;
+};
+
+cinder_bank* cinder_bank_create(int num_instances)
+{
+    if (num_instances <= 0)
+        return nullptr;
+
+    try
+    {
+        auto bank = std::make_unique<cinder_bank>();
+        const int numGroups = (num_instances + cinder_bank::Batch::numLanes - 1) / cinder_bank::Batch::numLanes;
+
+        bank->numInstances = num_instances;
+        for (int g = 0; g < numGroups; ++g)
+            bank->groups.push_back(std::make_unique<cinder_bank::Batch>());
+        bank->inputs.assign(static_cast<size_t>(numGroups * cinder_bank::Batch::numLanes), nullptr);
+        bank->outputs.assign(static_cast<size_t>(numGroups * cinder_bank::Batch::numLanes), nullptr);
+        return bank.release();
+    }
+    catch (const std::bad_alloc&)
+    {
+        return nullptr;
+    }
+}
+
+int cinder_bank_get_num_instances(const cinder_bank* bank)
+{
+    return bank != nullptr ? bank->numInstances : 0;
+}
+
+cinder_result cinder_bank_prepare(cinder_bank* bank, double sample_rate, int max_block_size)
+{
+    if (bank == nullptr || ! (sample_rate > 0.0) || max_block_size <= 0)
+        return CINDER_ERROR_INVALID_ARGUMENT;
+
+    try
+    {
+        for (auto& group : bank->groups)
+            group->prepare(sample_rate, max_block_size);
+    }
+    catch (const std::bad_alloc&)
+    {
+        bank->maxBlockSize = 0;
+        return CINDER_ERROR_OUT_OF_MEMORY;
+    }
+
+    bank->maxBlockSize = max_block_size;
+    return CINDER_OK;
+}
+
+cinder_result cinder_bank_set_instance(cinder_bank* bank, int instance,
+                                       float decay, float shimmer, float size, float burn)
+{
+    if (bank == nullptr || instance < 0 || instance >= bank->numInstances)
+        return CINDER_ERROR_INVALID_ARGUMENT;
+    if (bank->maxBlockSize <= 0)
+        return CINDER_ERROR_NOT_PREPARED;
+
+    // Same mapping as CinderEngine: decay > 29.5s is infinite
+    const auto& decayRange = CinderEngine::paramRanges[CinderEngine::decay];
+    decay = std::clamp(decay, decayRange.minValue, decayRange.maxValue);
+    const float decaySeconds = decay > 29.5f ? 100.0f : decay;
+
+    const int lanes = cinder_bank::Batch::numLanes;
+    bank->groups[static_cast<size_t>(instance / lanes)]->setParameters(instance % lanes, decaySeconds,
+                                                                       std::clamp(shimmer, 0.0f, 1.0f),
+                                                                       std::clamp(size, 0.0f, 1.0f),
+                                                                       std::clamp(burn, 0.0f, 1.0f));
+    return CINDER_OK;
+}
+
+cinder_result cinder_bank_set_delay_storage(cinder_bank* bank, cinder_storage storage)
+{
+    if (bank == nullptr || ! isValidStorage(storage))
+        return CINDER_ERROR_INVALID_ARGUMENT;
+
+    for (auto& group : bank->groups)
+        group->setDelayStorage(static_cast<SampleStorage>(storage));
+    return CINDER_OK;
+}
+
+cinder_result cinder_bank_reset_instance(cinder_bank* bank, int instance)
+{
+    if (bank == nullptr || instance < 0 || instance >= bank->numInstances)
+        return CINDER_ERROR_INVALID_ARGUMENT;
+    if (bank->maxBlockSize <= 0)
+        return CINDER_ERROR_NOT_PREPARED;
+
+    const int lanes = cinder_bank::Batch::numLanes;
+    bank->groups[static_cast<size_t>(instance / lanes)]->resetLane(instance % lanes);
+    return CINDER_OK;
+}
+
+void cinder_bank_reset(cinder_bank* bank)
+{
+    if (bank != nullptr && bank->maxBlockSize > 0)
+        for (auto& group : bank->groups)
+            group->reset();
+}
+
+cinder_result cinder_bank_process(cinder_bank* bank,
+                                  const float* const* inputs, float* const* outputs,
+                                  int num_samples)
+{
+    if (bank == nullptr || inputs == nullptr || outputs == nullptr || num_samples < 0)
+        return CINDER_ERROR_INVALID_ARGUMENT;
+    if (bank->maxBlockSize <= 0)
+        return CINDER_ERROR_NOT_PREPARED;
+
+    std::copy(inputs, inputs + bank->numInstances, bank->inputs.begin());
+    std::copy(outputs, outputs + bank->numInstances, bank->outputs.begin());
+
+    FlushDenormals noDenormals;
+
+    const int lanes = cinder_bank::Batch::numLanes;
+    for (size_t g = 0; g < bank->groups.size(); ++g)
+        bank->groups[g]->process(bank->inputs.data() + g * lanes, bank->outputs.data() + g * lanes, num_samples);
+
+    return CINDER_OK;
+}
+
+void cinder_bank_destroy(cinder_bank* bank)
+{
+    delete bank;
+}
@@ -0,0 +1,190 @@
+/*
+ * cinder_dsp.h - Plain C interface to the Cinder DSP core (no JUCE)
+ *
+ * Lifecycle:
+ *   cinder_dsp* fx = cinder_dsp_create();
+ *   cinder_dsp_prepare(fx, 48000.0, 512);            // allocates everything
+ *   cinder_dsp_set_param(fx, CINDER_PARAM_DECAY, 6.0f);
+ *   cinder_dsp_process_block(fx, inL, inR, outL, outR, n);
+ *   cinder_dsp_destroy(fx);
+ *
+ * Buffers are owned by the caller; input and output may be the same memory.
+ * Nothing allocates after prepare. set_param is safe from any thread and
+ * applies (smoothed) from the next process_block call; the other functions
+ * must not run concurrently on the same instance.
+ *
+ * cinder_bank runs many wet-only reverbs (one per zone/emitter) in SIMD
+ * lanes, for hosts that need dozens of instances at once.
+ */
+#ifndef CINDER_DSP_H
+#define CINDER_DSP_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct cinder_dsp cinder_dsp;
+
+typedef enum cinder_param
+{
+    CINDER_PARAM_DRIVE = 0,   /* 0..1   input saturation                 */
+    CINDER_PARAM_DECAY,       /* 0.1..30 seconds, > 29.5 = infinite     */
+    CINDER_PARAM_SHIMMER,     /* 0..1   octave-up feedback               */
+    CINDER_PARAM_BURN,        /* 0..1   saturation inside the feedback   */
+    CINDER_PARAM_SIZE,        /* 0..1   room size                        */
+    CINDER_PARAM_DUCK,        /* 0..1   dry-keyed ducking of the wet     */
+    CINDER_PARAM_MIX,         /* 0..1   dry/wet                          */
+    CINDER_PARAM_FREEZE,      /* 0 or 1 infinite sustain, input gated    */
+    CINDER_PARAM_LOW_DECAY,   /* 0.25..4 x DECAY below 250 Hz           */
+    CINDER_PARAM_HIGH_DECAY,  /* 0.25..4 x DECAY above 4 kHz            */
+    CINDER_PARAM_MODULATION,  /* 0..1   LFO depth on the FDN lines       */
+    CINDER_PARAM_MORPH,       /* 0..1   snapshot A -> B (see below)      */
+    CINDER_PARAM_COUNT
+} cinder_param;
+
+typedef enum cinder_result
+{
+    CINDER_OK = 0,
+    CINDER_ERROR_INVALID_ARGUMENT = -1,
+    CINDER_ERROR_NOT_PREPARED = -2,
+    CINDER_ERROR_OUT_OF_MEMORY = -3
+} cinder_result;
+
+/* Returns NULL if allocation fails. Parameters start at their defaults.
+   Only the handle itself is allocated: DSP memory waits for prepare. */
+cinder_dsp* cinder_dsp_create(void);
+
+/* Allocates all DSP memory for the given rate and maximum block size.
+   Preparing again only redoes what changed: the same rate and block size
+   keep every buffer and the running tail, and a new block size only resizes
+   the block scratch. */
+cinder_result cinder_dsp_prepare(cinder_dsp* dsp, double sample_rate, int max_block_size);
+
+/* Values are clamped to the ranges above; NaN is ignored. */
+cinder_result cinder_dsp_set_param(cinder_dsp* dsp, cinder_param param, float value);
+float cinder_dsp_get_param(const cinder_dsp* dsp, cinder_param param);
+
+/* Clears the reverb tails and jumps smoothing to the current parameters.
+   Constant time: the delay memory is marked stale rather than zero-filled. */
+void cinder_dsp_reset(cinder_dsp* dsp);
+
+/* Stereo processing. in_r may be NULL for mono input (in_l feeds both sides).
+   Blocks longer than max_block_size are split internally. */
+cinder_result cinder_dsp_process_block(cinder_dsp* dsp,
+                                       const float* in_l, const float* in_r,
+                                       float* out_l, float* out_r,
+                                       int num_samples);
+
+/* Tail spillover (off by default). When DECAY, SHIMMER, BURN, SIZE or a band
+   decay jumps by more than a quarter of its range within one call, a second
+   engine takes over at the new settings while the old tail rings out
+   untouched. The old one stops once it is below -90 dBFS. Enabling it takes
+   effect at the next prepare, which then allocates both engines, so
+   switching never allocates. While a tail spills, processing costs up to
+   twice as much. */
+cinder_result cinder_dsp_set_spillover(cinder_dsp* dsp, int enabled);
+
+/* A/B morph. Stores CINDER_PARAM_COUNT values (indexed by cinder_param;
+   FREEZE and MORPH are ignored) as snapshot A (slot 0) or B (slot 1). While
+   both are set and CINDER_PARAM_MORPH is above 0, it blends from A to B and
+   replaces the other parameters (FREEZE aside); at 0 they apply as usual.
+   The reverb coefficients for each snapshot are computed here, so sweeping
+   MORPH costs one lerp per coefficient per sample. Safe from any thread but the processing one, one call at a time;
+   applies from the next process_block call. */
+cinder_result cinder_dsp_set_snapshot(cinder_dsp* dsp, int slot, const float* values);
+void cinder_dsp_clear_snapshots(cinder_dsp* dsp);
+
+/* Blocks muted because a NaN or infinity reached the reverb (e.g. from
+   garbage input). Each time, the tails are cleared and the output fades back
+   in; a non-zero count means the input needs a look. */
+int cinder_dsp_get_recovery_count(const cinder_dsp* dsp);
+
+void cinder_dsp_destroy(cinder_dsp* dsp);
+
+/* --- Delay storage ---
+   Sample format of the reverb delay lines and pitch buffer. The 16-bit
+   formats halve the memory each instance streams through per sample, at the
+   cost of a noise floor under the tail: float16 stays ~66 dB below the
+   signal, int16 sits at -96 dBFS (a grittier decay). Applies at the next
+   prepare. */
+typedef enum cinder_storage
+{
+    CINDER_STORAGE_FLOAT32 = 0,   /* default */
+    CINDER_STORAGE_FLOAT16,
+    CINDER_STORAGE_INT16
+} cinder_storage;
+
+cinder_result cinder_dsp_set_delay_storage(cinder_dsp* dsp, cinder_storage storage);
+
+/* --- Input diffusion ---
+   How the reverb smears transients before the delay network: four serial
+   allpasses (default), or a sparse velvet-noise filter with the same smear
+   and level, no feedback and fewer operations per sample. Takes effect
+   immediately; call between process calls. */
+typedef enum cinder_diffusion
+{
+    CINDER_DIFFUSION_ALLPASS = 0,   /* default */
+    CINDER_DIFFUSION_VELVET
+} cinder_diffusion;
+
+cinder_result cinder_dsp_set_input_diffusion(cinder_dsp* dsp, cinder_diffusion diffusion);
+
+/* --- SIMD level ---
+   Instances pick the widest kernels the CPU supports when they are prepared.
+   Benchmarks can force a lower (or equal) level; it applies to every instance
+   prepared afterwards. CINDER_SIMD=generic|avx2|avx512 does the same from the
+   environment. */
+typedef enum cinder_simd_level
+{
+    CINDER_SIMD_GENERIC = 0,   /* SSE2 on x86-64, scalar elsewhere */
+    CINDER_SIMD_AVX2,
+    CINDER_SIMD_AVX512
+} cinder_simd_level;
+
+/* Level the next prepare will use. */
+cinder_simd_level cinder_get_simd_level(void);
+
+/* Fails with CINDER_ERROR_INVALID_ARGUMENT if this CPU cannot run `level`. */
+cinder_result cinder_force_simd_level(cinder_simd_level level);
+void cinder_clear_forced_simd_level(void);
+
+const char* cinder_simd_level_name(cinder_simd_level level);
+
+/* --- Reverb bank: many independent mono reverbs, batched across SIMD lanes ---
+   Wet output only (no drive, duck or mix). Instances are processed in groups
+   of 16, so counts that are multiples of 16 waste no work. All functions must
+   be called from the processing thread; set_instance applies with a ramp
+   across the next process call. */
+typedef struct cinder_bank cinder_bank;
+
+/* Returns NULL if num_instances <= 0 or allocation fails. */
+cinder_bank* cinder_bank_create(int num_instances);
+int cinder_bank_get_num_instances(const cinder_bank* bank);
+
+/* Allocates all DSP memory. Instances start at decay 2s, size 0.5. */
+cinder_result cinder_bank_prepare(cinder_bank* bank, double sample_rate, int max_block_size);
+
+/* Same ranges as CINDER_PARAM_DECAY / SHIMMER / SIZE / BURN. */
+cinder_result cinder_bank_set_instance(cinder_bank* bank, int instance,
+                                       float decay, float shimmer, float size, float burn);
+
+/* As cinder_dsp_set_delay_storage, for every instance; applies at the next prepare. */
+cinder_result cinder_bank_set_delay_storage(cinder_bank* bank, cinder_storage storage);
+
+/* Clears one instance's tail (e.g. when an emitter is reused). */
+cinder_result cinder_bank_reset_instance(cinder_bank* bank, int instance);
+void cinder_bank_reset(cinder_bank* bank);
+
+/* inputs[i] / outputs[i] are instance i's mono buffers. A NULL input is
+   silence and a NULL output is skipped; input and output may alias. */
+cinder_result cinder_bank_process(cinder_bank* bank,
+                                  const float* const* inputs, float* const* outputs,
+                                  int num_samples);
+
+void cinder_bank_destroy(cinder_bank* bank);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CINDER_DSP_H */
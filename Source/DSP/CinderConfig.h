@@ -0,0 +1,41 @@
+#pragma once
+
+/**
+ * CinderConfig - Compile-time build configurations
+ *
+ * Everything that differs between Cinder and Cinder Lite is a constant here,
+ * consumed through templates and `if constexpr`, so each binary only contains
+ * the code for its own configuration and its worst-case cost is fixed at
+ * build time.
+ *
+ *   Cinder       8-line FDN, tail spillover, animated waveform and output meter
+ *   Cinder Lite  4-line FDN, no spillover (one engine), editor with knobs only
+ *                (and the CPU / quality readout)
+ *
+ * Both run one dual-grain (+1 octave) shimmer pair and no oversampling.
+ * The plugin target defines CINDER_LITE=1 to pick the Lite configuration;
+ * the CinderDSP library and C API always use the full one.
+ */
+struct CinderFullConfig
+{
+    static constexpr int fdnOrder = 8;
+    static constexpr bool spillover = true;           // second engine for tails across preset changes
+    static constexpr float ecoLoad = 0.3f;            // share of the block deadline that sheds quality (QualityGovernor)
+    static constexpr bool animatedVisuals = true;     // waveform visualiser and output meter
+    static constexpr const char* displayName = "CINDER";
+};
+
+struct CinderLiteConfig
+{
+    static constexpr int fdnOrder = 4;
+    static constexpr bool spillover = false;
+    static constexpr float ecoLoad = 0.3f;
+    static constexpr bool animatedVisuals = false;
+    static constexpr const char* displayName = "CINDER LITE";
+};
+
+#if CINDER_LITE
+using CinderPluginConfig = CinderLiteConfig;
+#else
+using CinderPluginConfig = CinderFullConfig;
+#endif
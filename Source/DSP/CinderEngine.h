@@ -0,0 +1,748 @@
+#pragma once
+
+#include "ShimmerReverb.h"
+#include "LinearSmoother.h"
+#include "Kernels/Kernels.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+/**
+ * CinderEngine - The complete Cinder signal chain, free of JUCE
+ *
+ * Signal flow per sample:
+ *   dry → DRIVE (tanh) → FREEZE gate → ShimmerReverb (L/R) → DUCK → MIX
+ *
+ * LOW / HIGH DECAY scale the reverb's low and high RT60 relative to DECAY;
+ * MOD sweeps the FDN line lengths with slow LFOs.
+ *
+ * Shared by CinderProcessor and the C API (cinder_dsp.h), so the plugin and
+ * embedded builds run identical DSP. Parameter targets are atomics that can
+ * be set from any thread; they are picked up at the start of each block and
+ * smoothed over 50ms. All memory is allocated in prepare(), sized for the
+ * rate and block size given; constructing an engine allocates nothing (a
+ * host scanning plugins never pays for buffers), and release() frees it all
+ * again until the next prepare().
+ *
+ * A block runs in three passes: a control pass (smoothing, envelope, drive,
+ * freeze gate) into scratch buffers, one independent reverb task per channel,
+ * then the duck/mix/metering pass. The channel tasks share no state, so a
+ * caller with worker threads may run them concurrently (see process(..., runChannels)).
+ *
+ * Block guard: after each reverb task one vectorised scan of its wet block,
+ * plus the reverb's own per-interval check of what it wrote to its lines,
+ * catches a NaN or infinity (say from garbage host input) before it can
+ * circulate forever. The block is then muted, both reverbs and the envelope
+ * are reset, the output fades back in over 20ms and getRecoveryCount() goes
+ * up. A tail that has decayed into subnormals (no flush-to-zero on the
+ * calling thread) is inaudible, so that reverb and its wet block are just
+ * cleared. The hot loops themselves carry no per-sample checks.
+ *
+ * A/B morph: setSnapshot() stores two full parameter sets (the plugin
+ * captures its current values). While both are set and MORPH is above 0,
+ * MORPH blends from A to B and the engine plays the blend instead of the
+ * individual targets (FREEZE aside); at MORPH 0 the knobs play as usual.
+ * Engaging or releasing the morph, and re-capturing a snapshot while it is
+ * engaged, crossfade over the parameter smoothing time, so the coefficients
+ * never step. The reverb's endpoint coefficients (feedback gain, damping,
+ * shimmer compensation, BURN drive) are computed once, on the thread that
+ * stores the snapshot; each sample then costs one lerp per coefficient and
+ * no pow, so MORPH can be swept by automation as fast as the host likes. The
+ * other parameters are linear in their effect and blend directly. Band decay
+ * shelves follow the blended multipliers at control rate, as for any other
+ * parameter move.
+ *
+ * Templated on the reverb's FDN order (see CinderConfig.h); CinderEngine is
+ * the full 8-line chain.
+ */
+template <int fdnOrder>
+class BasicCinderEngine
+{
+public:
+    enum Param
+    {
+        drive = 0,
+        decay,
+        shimmer,
+        burn,
+        size,
+        duck,
+        mix,
+        freeze,
+        lowDecay,
+        highDecay,
+        modulation,
+        morph,
+        numParams
+    };
+
+    struct ParamRange
+    {
+        float minValue, maxValue, defaultValue;
+    };
+
+    // Must match CinderProcessor::createParameterLayout
+    static constexpr std::array<ParamRange, numParams> paramRanges {{
+        { 0.0f,  1.0f, 0.0f },   // drive
+        { 0.1f, 30.0f, 2.0f },   // decay (seconds, > 29.5 = infinite)
+        { 0.0f,  1.0f, 0.0f },   // shimmer
+        { 0.0f,  1.0f, 0.0f },   // burn
+        { 0.0f,  1.0f, 0.5f },   // size
+        { 0.0f,  1.0f, 0.0f },   // duck
+        { 0.0f,  1.0f, 0.3f },   // mix
+        { 0.0f,  1.0f, 0.0f },   // freeze (>= 0.5 = on)
+        { 0.25f, 4.0f, 1.0f },   // low decay (x DECAY below 250 Hz)
+        { 0.25f, 4.0f, 1.0f },   // high decay (x DECAY above 4 kHz)
+        { 0.0f,  1.0f, 0.0f },   // modulation (LFO depth on the FDN lines)
+        { 0.0f,  1.0f, 0.0f },   // morph (snapshot A -> B, above 0 while both are set)
+    }};
+
+    static constexpr int numSnapshots = 2;
+
+    struct Meters
+    {
+        float reverbPeak = 0.0f;   // peak |wet L| (visualiser)
+        float outputRms = 0.0f;    // RMS of the mono output
+        float outputPeak = 0.0f;   // peak of the mono output
+    };
+
+    BasicCinderEngine()
+    {
+        for (int i = 0; i < numParams; ++i)
+            targets[static_cast<size_t>(i)].store(paramRanges[static_cast<size_t>(i)].defaultValue);
+    }
+
+    static constexpr int numChannelTasks = 2;
+
+    // Only what the new configuration changes is redone. The same rate and
+    // block size again (some hosts re-prepare on every transport or device
+    // hiccup) keeps every buffer and tail and just snaps the smoothing; a new
+    // block size only resizes the block scratch.
+    void prepare(double sampleRate, int maxBlockSize)
+    {
+        const bool rateChanged = ! prepared || sampleRate != preparedRate;
+        const int newMaxBlock = std::max(1, maxBlockSize);
+
+        // The reverbs compare their own configuration (rate, storage format)
+        shimmerReverbL.prepare(sampleRate, maxBlockSize);
+        shimmerReverbR.prepare(sampleRate, maxBlockSize);
+
+        // Metering kernels for this CPU (or the forced SIMD level)
+        kernels = &getKernels();
+
+        // Per-sample control values and channel buffers for one block
+        if (! prepared || newMaxBlock != maxBlock)
+        {
+            maxBlock = newMaxBlock;
+            for (auto* buffer : { &decayBuffer, &shimmerBuffer, &sizeBuffer, &burnBuffer, &lowDecayBuffer, &highDecayBuffer,
+                                  &modulationBuffer, &duckGainBuffer, &mixBuffer })
+                buffer->assign(static_cast<size_t>(maxBlock), 0.0f);
+            coefficientBuffer.assign(static_cast<size_t>(maxBlock), {});
+            for (auto& buffer : channelBuffers)
+                buffer.assign(static_cast<size_t>(maxBlock), 0.0f);
+        }
+        blockSize = 0;
+
+        if (rateChanged)
+        {
+            for (auto& smoother : smoothers)
+                smoother.reset(sampleRate, smoothingTime);
+
+            // Envelope follower coefficients
+            envAttackCoeff = std::exp(-1.0f / (0.0005f * static_cast<float>(sampleRate)));   // 0.5ms attack
+            envReleaseCoeff = std::exp(-1.0f / (0.15f * static_cast<float>(sampleRate)));    // 150ms release
+            envState = 0.0f;
+
+            recoveryFadeStep = 1.0f / (0.02f * static_cast<float>(sampleRate));   // 20ms fade-in after a recovery
+            recoveryFade = 1.0f;
+            channelFaults.fill(false);
+
+            modulationGate.reset(sampleRate, modulationGateTime);
+            morphGate.reset(sampleRate, smoothingTime);
+            for (auto& fade : snapshotFades)
+                fade.reset(sampleRate, smoothingTime);
+        }
+
+        // Fresh tails start with FREEZE open, ramping to its target
+        snapParameters();
+        if (rateChanged)
+            smoothers[freeze].setCurrentAndTargetValue(0.0f);
+
+        preparedRate = sampleRate;
+        prepared = true;
+    }
+
+    // Frees all DSP memory (parameters and settings are kept). process() must
+    // not run until the next prepare().
+    void release()
+    {
+        shimmerReverbL.release();
+        shimmerReverbR.release();
+        for (auto* buffer : { &decayBuffer, &shimmerBuffer, &sizeBuffer, &burnBuffer, &lowDecayBuffer, &highDecayBuffer,
+                              &modulationBuffer, &duckGainBuffer, &mixBuffer })
+            *buffer = std::vector<float>();
+        coefficientBuffer = std::vector<Coefficients>();
+        for (auto& buffer : channelBuffers)
+            buffer = std::vector<float>();
+        prepared = false;
+    }
+
+    bool isPrepared() const { return prepared; }
+
+    // Clears tails and jumps the smoothers to the current targets
+    void reset()
+    {
+        shimmerReverbL.reset();
+        shimmerReverbR.reset();
+        envState = 0.0f;
+        recoveryFade = 1.0f;
+        channelFaults.fill(false);
+        snapParameters();
+    }
+
+    // Jumps the smoothers to the current targets (no ramp); tails are kept
+    void snapParameters()
+    {
+        for (int i = 0; i < numParams; ++i)
+            smoothers[static_cast<size_t>(i)].setCurrentAndTargetValue(getTarget(i));
+        modulationGate.setCurrentAndTargetValue(modulationEnabled ? 1.0f : 0.0f);
+        morphGate.setCurrentAndTargetValue(morphEngaged() ? 1.0f : 0.0f);
+        for (auto& fade : snapshotFades)
+            fade.setCurrentAndTargetValue(1.0f);
+    }
+
+    // Blocks muted by the guard since construction (any thread)
+    int getRecoveryCount() const { return recoveryCount.load(std::memory_order_relaxed); }
+
+    // Safe from any thread; takes effect at the next process() call
+    void setParameter(int index, float value)
+    {
+        if (index < 0 || index >= numParams || std::isnan(value))
+            return;
+
+        const auto& range = paramRanges[static_cast<size_t>(index)];
+        targets[static_cast<size_t>(index)].store(std::clamp(value, range.minValue, range.maxValue),
+                                                  std::memory_order_relaxed);
+    }
+
+    float getParameter(int index) const
+    {
+        return (index >= 0 && index < numParams) ? targets[static_cast<size_t>(index)].load(std::memory_order_relaxed)
+                                                 : 0.0f;
+    }
+
+    /**
+     * Stores `values` (numParams of them, in Param order; FREEZE and MORPH
+     * are ignored) as snapshot A (slot 0) or B (slot 1), with the reverb
+     * coefficients they map to. Any thread but the audio thread, one at a
+     * time; the audio thread picks the snapshot up at its next block without
+     * locking (a block that races a store keeps the previous snapshot).
+     */
+    void setSnapshot(int slot, const float* values)
+    {
+        if (slot < 0 || slot >= numSnapshots || values == nullptr)
+            return;
+
+        Snapshot snapshot;
+        for (int i = 0; i < numParams; ++i)
+        {
+            const auto& range = paramRanges[static_cast<size_t>(i)];
+            const float value = std::isnan(values[i]) ? range.defaultValue : values[i];
+            snapshot.values[static_cast<size_t>(i)] = std::clamp(value, range.minValue, range.maxValue);
+        }
+        snapshot.coefficients = Reverb::computeCoefficients(toDecaySeconds(snapshot.values[decay]),
+                                                            snapshot.values[shimmer], snapshot.values[size],
+                                                            snapshot.values[burn]);
+
+        auto& shared = sharedSnapshots[static_cast<size_t>(slot)];
+        shared.write(snapshot);
+        shared.present.store(true, std::memory_order_release);
+    }
+
+    // Same threads as setSnapshot(). MORPH has no effect until both are set again
+    // (an engaged morph fades back to the knobs).
+    void clearSnapshots()
+    {
+        for (auto& shared : sharedSnapshots)
+            shared.present.store(false, std::memory_order_release);
+    }
+
+    bool hasSnapshot(int slot) const
+    {
+        return slot >= 0 && slot < numSnapshots
+            && sharedSnapshots[static_cast<size_t>(slot)].present.load(std::memory_order_acquire);
+    }
+
+    // FDN interpolator while SIZE ramps (settled SIZE uses integer taps).
+    // Audio thread, or before processing starts.
+    void setDelayInterpolation(DelayBuffer::Interpolation interpolation)
+    {
+        shimmerReverbL.setDelayInterpolation(interpolation);
+        shimmerReverbR.setDelayInterpolation(interpolation);
+    }
+
+    // Whole-sample FDN taps once SIZE settles (default on; see BasicShimmerReverb::setIntegerTaps)
+    void setIntegerTaps(bool enabled)
+    {
+        shimmerReverbL.setIntegerTaps(enabled);
+        shimmerReverbR.setIntegerTaps(enabled);
+    }
+
+    // Feedback DC blockers in the FDN (default on; see BasicShimmerReverb::setDcBlocking)
+    void setDcBlocking(bool enabled)
+    {
+        shimmerReverbL.setDcBlocking(enabled);
+        shimmerReverbR.setDcBlocking(enabled);
+    }
+
+    // Allpass chain or velvet-noise input diffuser. Audio thread, or before processing starts.
+    void setInputDiffusion(typename BasicShimmerReverb<fdnOrder>::InputDiffusion diffusion)
+    {
+        shimmerReverbL.setInputDiffusion(diffusion);
+        shimmerReverbR.setInputDiffusion(diffusion);
+    }
+
+    // BURN saturation with the vectorised Pade tanh (see BasicShimmerReverb::setFastBurn).
+    // Any time on the audio thread.
+    void setFastBurn(bool fast)
+    {
+        shimmerReverbL.setFastBurn(fast);
+        shimmerReverbR.setFastBurn(fast);
+    }
+
+    // Off fades MOD out over 250ms (and back in when turned on again), so the
+    // FDN lines settle onto their static paths. Audio thread, or before processing starts.
+    void setModulationEnabled(bool enabled) { modulationEnabled = enabled; }
+
+    // Sample format of both reverbs' delay memory; takes effect at the next prepare()
+    void setDelayStorage(SampleStorage storage)
+    {
+        shimmerReverbL.setDelayStorage(storage);
+        shimmerReverbR.setDelayStorage(storage);
+    }
+
+    // In-place stereo processing. `left` and `right` may alias (mono).
+    Meters process(float* left, float* right, int numSamples)
+    {
+        return process(left, right, numSamples, [this] {
+            for (int channel = 0; channel < numChannelTasks; ++channel)
+                processChannel(channel);
+        });
+    }
+
+    /**
+     * As above, but the reverb tasks are handed to `runChannels`, which must
+     * call processChannel(0 .. numChannelTasks - 1) once each, on any threads,
+     * and return only when all of them have finished. Called once per
+     * prepared-block-sized chunk.
+     */
+    template <typename RunChannels>
+    Meters process(float* left, float* right, int numSamples, RunChannels&& runChannels)
+    {
+        for (int i = 0; i < numParams; ++i)
+            smoothers[static_cast<size_t>(i)].setTargetValue(getTarget(i));
+        modulationGate.setTargetValue(modulationEnabled ? 1.0f : 0.0f);
+        updateSnapshots();
+        morphGate.setTargetValue(morphEngaged() ? 1.0f : 0.0f);
+
+        float peakLevel = 0.0f;
+        float sumSquares = 0.0f;
+        float blockPeak = 0.0f;
+
+        for (int pos = 0; pos < numSamples; pos += maxBlock)
+        {
+            blockSize = std::min(maxBlock, numSamples - pos);
+            computeControls(left + pos, right + pos);
+            runChannels();
+
+            if (channelFaults[0] || channelFaults[1] || ! std::isfinite(envState))
+                recoverFromFault(left + pos, right + pos);
+            else
+                mixAndMeter(left + pos, right + pos, peakLevel, sumSquares, blockPeak);
+        }
+
+        Meters meters;
+        meters.reverbPeak = peakLevel;
+        if (numSamples > 0)
+        {
+            meters.outputRms = std::sqrt(sumSquares / static_cast<float>(numSamples));
+            meters.outputPeak = blockPeak;
+        }
+        return meters;
+    }
+
+    // Runs one channel's reverb over the current block (driven input -> wet)
+    void processChannel(int channel)
+    {
+        auto& reverb = channel == 0 ? shimmerReverbL : shimmerReverbR;
+        float* samples = channelBuffers[static_cast<size_t>(channel)].data();
+
+        // Burn is applied inside the feedback loop
+        reverb.processBlock(samples, blockSize, { decayBuffer.data(), shimmerBuffer.data(), sizeBuffer.data(),
+                                                  burnBuffer.data(), lowDecayBuffer.data(), highDecayBuffer.data(),
+                                                  modulationBuffer.data(),
+                                                  morphing ? coefficientBuffer.data() : nullptr });
+
+        // Block guard (see the class comment); process() acts on the flag
+        const auto scan = kernels->scanBlock(samples, blockSize);
+        const bool fault = scan.nonFinite || ! reverb.isStateFinite();
+        channelFaults[static_cast<size_t>(channel)] = fault;
+        if (scan.subnormal && ! fault && kernels->peakAbs(samples, blockSize) < silentTail)
+        {
+            reverb.reset();
+            std::fill_n(samples, blockSize, 0.0f);
+        }
+    }
+
+private:
+    using Reverb = BasicShimmerReverb<fdnOrder>;
+    using Coefficients = typename Reverb::Coefficients;
+
+    // DSP components
+    Reverb shimmerReverbL, shimmerReverbR;
+
+    const CinderKernels* kernels = nullptr;   // chosen in prepare()
+
+    // Block scratch: per-sample control values, then driven input / wet per channel
+    int maxBlock = 1;
+    int blockSize = 0;
+    bool prepared = false;
+    double preparedRate = 0.0;
+    std::vector<float> decayBuffer, shimmerBuffer, sizeBuffer, burnBuffer, lowDecayBuffer, highDecayBuffer;
+    std::vector<float> modulationBuffer, duckGainBuffer, mixBuffer;
+    std::array<std::vector<float>, numChannelTasks> channelBuffers;
+    std::vector<Coefficients> coefficientBuffer;   // per sample, while morphing
+
+    // Parameter targets (any thread) and their smoothed values (audio thread)
+    std::array<std::atomic<float>, numParams> targets;
+    std::array<LinearSmoother, numParams> smoothers;
+
+    // 50ms parameter smoothing time (also the morph crossfades)
+    static constexpr double smoothingTime = 0.05;
+
+    // MOD on / off (setModulationEnabled), as a gain on the smoothed depth
+    static constexpr double modulationGateTime = 0.25;
+    bool modulationEnabled = true;
+    LinearSmoother modulationGate;
+
+    // A/B snapshots: published by setSnapshot() through a sequence lock (the
+    // audio thread never waits: it keeps its copy if a store is in progress)
+    struct Snapshot
+    {
+        std::array<float, numParams> values {};
+        Coefficients coefficients;
+    };
+
+    static_assert(sizeof(Snapshot) % sizeof(float) == 0, "snapshots are stored as floats");
+
+    struct SharedSnapshot
+    {
+        static constexpr size_t numWords = sizeof(Snapshot) / sizeof(float);
+
+        std::atomic<std::uint32_t> sequence { 0 };   // odd while a store is in progress
+        std::array<std::atomic<float>, numWords> words {};
+        std::atomic<bool> present { false };
+
+        void write(const Snapshot& snapshot)
+        {
+            const auto source = std::bit_cast<std::array<float, numWords>>(snapshot);
+
+            const auto start = sequence.load(std::memory_order_relaxed);
+            sequence.store(start + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            for (size_t i = 0; i < numWords; ++i)
+                words[i].store(source[i], std::memory_order_relaxed);
+            sequence.store(start + 2, std::memory_order_release);
+        }
+
+        // False (snapshot untouched) if a store was in progress
+        bool tryRead(Snapshot& snapshot) const
+        {
+            const auto start = sequence.load(std::memory_order_acquire);
+            if ((start & 1) != 0)
+                return false;
+
+            std::array<float, numWords> copy;
+            for (size_t i = 0; i < numWords; ++i)
+                copy[i] = words[i].load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (sequence.load(std::memory_order_relaxed) != start)
+                return false;
+
+            snapshot = std::bit_cast<Snapshot>(copy);
+            return true;
+        }
+    };
+
+    std::array<SharedSnapshot, numSnapshots> sharedSnapshots;
+    std::array<Snapshot, numSnapshots> snapshots;              // audio thread copies
+    std::array<std::uint32_t, numSnapshots> snapshotSequences {};
+    std::array<bool, numSnapshots> snapshotsLoaded {};
+
+    // Blend weight from the knobs (0) to the A/B morph (1), and per slot the
+    // fade (0 -> 1) from the snapshot a re-capture replaced
+    LinearSmoother morphGate;
+    std::array<Snapshot, numSnapshots> previousSnapshots;
+    std::array<LinearSmoother, numSnapshots> snapshotFades;
+    bool morphing = false;                                     // blend in use, for this block
+
+    // Block guard: per-channel flags (written by the channel tasks), fade-in after a recovery
+    static constexpr float silentTail = 1.0e-30f;
+    std::array<bool, numChannelTasks> channelFaults {};
+    std::atomic<int> recoveryCount { 0 };
+    float recoveryFade = 1.0f;
+    float recoveryFadeStep = 1.0f;
+
+    // Envelope follower state (for sidechain ducking)
+    float envState = 0.0f;
+    float envAttackCoeff = 0.0f;   // ~0.5ms attack
+    float envReleaseCoeff = 0.0f;  // ~150ms release
+
+    // Control pass: smoothing, envelope, drive and freeze gate (left/right untouched)
+    void computeControls(const float* left, const float* right)
+    {
+        morphing = morphGate.isSmoothing() || morphGate.getTargetValue() > 0.0f;
+
+        for (int i = 0; i < blockSize; ++i)
+        {
+            const auto n = static_cast<size_t>(i);
+
+            // Get smoothed parameter values
+            float drv = smoothers[drive].getNextValue();
+            const float dcy = smoothers[decay].getNextValue();
+            const float shm = smoothers[shimmer].getNextValue();
+            const float brn = smoothers[burn].getNextValue();
+            const float sz = smoothers[size].getNextValue();
+            float dck = smoothers[duck].getNextValue();
+            const float mx = smoothers[mix].getNextValue();
+            const float fz = smoothers[freeze].getNextValue();
+
+            // When frozen, lerp decay toward infinite (100.0)
+            const float baseDecay = toDecaySeconds(dcy);
+            decayBuffer[n] = baseDecay + fz * (100.0f - baseDecay);
+            shimmerBuffer[n] = shm;
+            sizeBuffer[n] = sz;
+            burnBuffer[n] = brn;
+            lowDecayBuffer[n] = smoothers[lowDecay].getNextValue();
+            highDecayBuffer[n] = smoothers[highDecay].getNextValue();
+            modulationBuffer[n] = smoothers[modulation].getNextValue();
+            mixBuffer[n] = mx;
+
+            // A/B morph: the blend replaces the individual parameters (FREEZE aside)
+            const float mrp = smoothers[morph].getNextValue();
+            const float engaged = morphGate.getNextValue();
+            if (morphing)
+                morphControls(n, mrp, engaged, fz, drv, dck);
+            modulationBuffer[n] *= modulationGate.getNextValue();
+
+            const float dryL = left[i];
+            const float dryR = right[i];
+
+            // Envelope follower on dry signal (for sidechain ducking)
+            const float dryMono = (std::abs(dryL) + std::abs(dryR)) * 0.5f;
+            const float envCoeff = (dryMono > envState) ? envAttackCoeff : envReleaseCoeff;
+            envState = envCoeff * envState + (1.0f - envCoeff) * dryMono;
+
+            // Sidechain ducking gain
+            //    envState is raw amplitude (0-1 range for typical signals).
+            //    Scale by 5x so a signal peaking at ~0.5 drives full ducking.
+            float duckGain = 1.0f;
+            if (dck > 0.001f)
+            {
+                float envScaled = std::min(envState * 5.0f, 1.0f);
+                duckGain = std::max(0.0f, 1.0f - dck * envScaled);
+            }
+            duckGainBuffer[n] = duckGain;
+
+            // DRIVE saturation (warm input distortion)
+            //    driveGain: 1x (clean) to 6x (heavy saturation)
+            const float driveGain = 1.0f + drv * 5.0f;
+
+            // Gate input when frozen (smoothed to avoid clicks)
+            channelBuffers[0][n] = std::tanh(dryL * driveGain) * (1.0f - fz);
+            channelBuffers[1][n] = std::tanh(dryR * driveGain) * (1.0f - fz);
+        }
+    }
+
+    // One sample of the A/B blend at position t: reverb coefficients (with
+    // FREEZE holding the loop at the infinite gain, as the decay lerp does
+    // for the individual parameters) and the remaining controls. Below full
+    // engagement the result is blended with the knobs' own values.
+    void morphControls(size_t n, float t, float engaged, float fz, float& drv, float& dck)
+    {
+        Snapshot fadingA, fadingB;
+        const auto& a = snapshotAt(0, fadingA);
+        const auto& b = snapshotAt(1, fadingB);
+        const auto blend = [&](int index) {
+            const auto i = static_cast<size_t>(index);
+            return a.values[i] + t * (b.values[i] - a.values[i]);
+        };
+
+        auto coefficients = Coefficients::lerp(a.coefficients, b.coefficients, t);
+        coefficients.feedbackGain += fz * (Reverb::infiniteFeedbackGain - coefficients.feedbackGain);
+        coefficients.decayTime += fz * (100.0f - coefficients.decayTime);
+
+        if (engaged < 1.0f)
+        {
+            // Knobs -> blend: the knobs' coefficients take the one pow the unmorphed path would
+            const auto knobs = Reverb::computeCoefficients(decayBuffer[n], shimmerBuffer[n], sizeBuffer[n], burnBuffer[n]);
+            const auto toward = [engaged](float knob, float morphed) { return knob + engaged * (morphed - knob); };
+
+            coefficientBuffer[n] = Coefficients::lerp(knobs, coefficients, engaged);
+            sizeBuffer[n] = coefficientBuffer[n].roomSize;
+            lowDecayBuffer[n] = toward(lowDecayBuffer[n], blend(lowDecay));
+            highDecayBuffer[n] = toward(highDecayBuffer[n], blend(highDecay));
+            modulationBuffer[n] = toward(modulationBuffer[n], blend(modulation));
+            mixBuffer[n] = toward(mixBuffer[n], blend(mix));
+            drv = toward(drv, blend(drive));
+            dck = toward(dck, blend(duck));
+            return;
+        }
+
+        coefficientBuffer[n] = coefficients;
+        sizeBuffer[n] = coefficients.roomSize;
+
+        lowDecayBuffer[n] = blend(lowDecay);
+        highDecayBuffer[n] = blend(highDecay);
+        modulationBuffer[n] = blend(modulation);
+        mixBuffer[n] = blend(mix);
+        drv = blend(drive);
+        dck = blend(duck);
+    }
+
+    // MORPH above 0 with both snapshots set
+    bool morphEngaged() const
+    {
+        return snapshotsLoaded[0] && snapshotsLoaded[1] && getTarget(morph) > 0.0f;
+    }
+
+    static Snapshot lerpSnapshot(const Snapshot& a, const Snapshot& b, float t)
+    {
+        Snapshot result;
+        for (size_t i = 0; i < a.values.size(); ++i)
+            result.values[i] = a.values[i] + t * (b.values[i] - a.values[i]);
+        result.coefficients = Coefficients::lerp(a.coefficients, b.coefficients, t);
+        return result;
+    }
+
+    // A slot's snapshot for the next sample: while a re-capture fades in, the
+    // blend from the one it replaced (written to `fading`)
+    const Snapshot& snapshotAt(size_t slot, Snapshot& fading)
+    {
+        auto& fade = snapshotFades[slot];
+        if (! fade.isSmoothing())
+            return snapshots[slot];
+
+        fading = lerpSnapshot(previousSnapshots[slot], snapshots[slot], fade.getNextValue());
+        return fading;
+    }
+
+    // Block start: take up any newly stored snapshots; morph only while both
+    // are set. A snapshot replaced while the blend is in use fades over to
+    // the new one instead of stepping the coefficients.
+    void updateSnapshots()
+    {
+        const bool blending = morphGate.isSmoothing() || morphGate.getTargetValue() > 0.0f;
+        if (! blending)
+            for (auto& fade : snapshotFades)
+                fade.setCurrentAndTargetValue(1.0f);
+
+        for (size_t slot = 0; slot < snapshots.size(); ++slot)
+        {
+            const auto& shared = sharedSnapshots[slot];
+            if (! shared.present.load(std::memory_order_acquire))
+            {
+                snapshotsLoaded[slot] = false;
+                continue;
+            }
+
+            const auto sequence = shared.sequence.load(std::memory_order_relaxed);
+            Snapshot stored;
+            if ((! snapshotsLoaded[slot] || sequence != snapshotSequences[slot]) && shared.tryRead(stored))
+            {
+                if (blending)
+                {
+                    auto& fade = snapshotFades[slot];
+                    previousSnapshots[slot] = fade.isSmoothing()
+                                                ? lerpSnapshot(previousSnapshots[slot], snapshots[slot], fade.getCurrentValue())
+                                                : snapshots[slot];
+                    fade.setCurrentAndTargetValue(0.0f);
+                    fade.setTargetValue(1.0f);
+                }
+
+                snapshots[slot] = stored;
+                snapshotSequences[slot] = sequence;
+                snapshotsLoaded[slot] = true;
+            }
+        }
+    }
+
+    // Ducking, dry/wet mix (in place) and metering
+    void mixAndMeter(float* left, float* right, float& peakLevel, float& sumSquares, float& blockPeak)
+    {
+        float* wetL = channelBuffers[0].data();
+        float* wetR = channelBuffers[1].data();
+
+        for (int i = 0; i < blockSize; ++i)
+        {
+            const auto n = static_cast<size_t>(i);
+            wetL[i] *= duckGainBuffer[n];
+            wetR[i] *= duckGainBuffer[n];
+            const float mx = mixBuffer[n];
+
+            // Final dry/wet mix (read both first: left and right may alias)
+            const float dryL = left[i];
+            const float dryR = right[i];
+            left[i] = dryL * (1.0f - mx) + wetL[i] * mx;
+            right[i] = dryR * (1.0f - mx) + wetR[i] * mx;
+        }
+
+        // Fade back in after a recovery (read both first: left and right may alias)
+        if (recoveryFade < 1.0f)
+        {
+            for (int i = 0; i < blockSize; ++i)
+            {
+                recoveryFade = std::min(1.0f, recoveryFade + recoveryFadeStep);
+                const float outL = left[i] * recoveryFade;
+                const float outR = right[i] * recoveryFade;
+                left[i] = outL;
+                right[i] = outR;
+            }
+        }
+
+        // Peak for visualization, output metering (CPU-dispatched kernels)
+        peakLevel = std::max(peakLevel, kernels->peakAbs(wetL, blockSize));
+        kernels->measureStereo(left, right, blockSize, blockPeak, sumSquares);
+    }
+
+    // A NaN or infinity got into a reverb or the envelope: mute this block
+    // (dry included, it may be the culprit), clear the state it reached and
+    // fade back in from the next block
+    void recoverFromFault(float* left, float* right)
+    {
+        std::fill(left, left + blockSize, 0.0f);
+        std::fill(right, right + blockSize, 0.0f);
+
+        shimmerReverbL.reset();
+        shimmerReverbR.reset();
+        envState = 0.0f;
+        channelFaults.fill(false);
+        recoveryFade = 0.0f;
+        recoveryCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // DECAY above 29.5s is infinite
+    static float toDecaySeconds(float decaySeconds) { return decaySeconds > 29.5f ? 100.0f : decaySeconds; }
+
+    float getTarget(int index) const
+    {
+        const float value = targets[static_cast<size_t>(index)].load(std::memory_order_relaxed);
+        return index == freeze ? (value >= 0.5f ? 1.0f : 0.0f) : value;
+    }
+};
+
+using CinderEngine = BasicCinderEngine<8>;
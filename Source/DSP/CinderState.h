@@ -0,0 +1,159 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+/**
+ * CinderState - Compact binary plugin state
+ *
+ *   bytes 0-3   magic "CNDR"
+ *   bytes 4-5   format version (little-endian)
+ *   bytes 6-7   number of values that follow
+ *   then        one little-endian float32 per parameter, in Param order
+ *   optionally  the A/B morph snapshots: a little-endian uint16 mask (bit 0
+ *               = A, bit 1 = B), then for each snapshot present as many
+ *               float32 values as above, in the same order
+ *
+ * Values are plain (not normalised) parameter values, indexed like
+ * BasicCinderEngine::Param, so the layout is fixed and parameter IDs never
+ * appear in the data. New parameters are only ever appended: a reader takes
+ * the values it knows and leaves the rest at their defaults, in either
+ * direction. Readers that predate snapshots stop after the values and
+ * never see them. The version only changes if an existing slot changes meaning.
+ *
+ * Reading and writing touch no heap memory. The plugin still loads the old
+ * XML state for sessions saved before this format existed.
+ */
+namespace CinderState
+{
+inline constexpr std::uint8_t magic[4] = { 'C', 'N', 'D', 'R' };
+inline constexpr std::uint16_t version = 1;
+inline constexpr size_t headerSize = 8;
+inline constexpr int maxSnapshots = 2;
+
+// Little-endian float32 at `bytes` (constexpr, so banks can be built at compile time)
+inline constexpr void writeFloat(std::uint8_t* bytes, float value)
+{
+    const auto bits = std::bit_cast<std::uint32_t>(value);
+    bytes[0] = static_cast<std::uint8_t>(bits);
+    bytes[1] = static_cast<std::uint8_t>(bits >> 8);
+    bytes[2] = static_cast<std::uint8_t>(bits >> 16);
+    bytes[3] = static_cast<std::uint8_t>(bits >> 24);
+}
+
+inline constexpr float readFloat(const std::uint8_t* bytes)
+{
+    return std::bit_cast<float>(static_cast<std::uint32_t>(bytes[0]) | (static_cast<std::uint32_t>(bytes[1]) << 8)
+                                | (static_cast<std::uint32_t>(bytes[2]) << 16) | (static_cast<std::uint32_t>(bytes[3]) << 24));
+}
+
+inline constexpr size_t getSize(int numValues)
+{
+    return headerSize + 4 * static_cast<size_t>(numValues);
+}
+
+// With the snapshot section, for snapshots present as in `snapshots` (null = absent)
+inline size_t getSize(int numValues, const float* const (&snapshots)[maxSnapshots])
+{
+    size_t size = getSize(numValues) + 2;
+    for (const float* snapshot : snapshots)
+        if (snapshot != nullptr)
+            size += 4 * static_cast<size_t>(numValues);
+    return size;
+}
+
+inline bool isBinaryState(const void* data, size_t size)
+{
+    return data != nullptr && size >= headerSize && std::memcmp(data, magic, sizeof(magic)) == 0;
+}
+
+// Writes getSize(numValues) bytes to dest
+inline void write(void* dest, const float* values, int numValues)
+{
+    auto* out = static_cast<std::uint8_t*>(dest);
+    std::memcpy(out, magic, sizeof(magic));
+    out[4] = static_cast<std::uint8_t>(version & 0xff);
+    out[5] = static_cast<std::uint8_t>(version >> 8);
+    out[6] = static_cast<std::uint8_t>(numValues & 0xff);
+    out[7] = static_cast<std::uint8_t>(numValues >> 8);
+
+    out += headerSize;
+    for (int i = 0; i < numValues; ++i, out += 4)
+        writeFloat(out, values[i]);
+}
+
+// Writes getSize(numValues, snapshots) bytes to dest: the values, then each
+// snapshot that is not null (numValues values each)
+inline void write(void* dest, const float* values, int numValues, const float* const (&snapshots)[maxSnapshots])
+{
+    write(dest, values, numValues);
+
+    auto* out = static_cast<std::uint8_t*>(dest) + getSize(numValues);
+    int mask = 0;
+    for (int s = 0; s < maxSnapshots; ++s)
+        if (snapshots[s] != nullptr)
+            mask |= 1 << s;
+    out[0] = static_cast<std::uint8_t>(mask);
+    out[1] = 0;
+
+    out += 2;
+    for (const float* snapshot : snapshots)
+        if (snapshot != nullptr)
+            for (int i = 0; i < numValues; ++i, out += 4)
+                writeFloat(out, snapshot[i]);
+}
+
+// Reads up to maxValues values. Returns how many were read, or -1 if the
+// data is not this format, is truncated or has an unknown version.
+inline int read(const void* data, size_t size, float* values, int maxValues)
+{
+    if (! isBinaryState(data, size))
+        return -1;
+
+    const auto* in = static_cast<const std::uint8_t*>(data);
+    const int dataVersion = in[4] | (in[5] << 8);
+    const int numValues = in[6] | (in[7] << 8);
+    if (dataVersion != version || size < getSize(numValues))
+        return -1;
+
+    const int count = numValues < maxValues ? numValues : maxValues;
+    in += headerSize;
+    for (int i = 0; i < count; ++i, in += 4)
+        values[i] = readFloat(in);
+    return count;
+}
+
+// Reads up to maxValues values of snapshot `slot` (0 = A, 1 = B). Returns how
+// many were read, or -1 if the state is not this format or has no such snapshot.
+inline int readSnapshot(const void* data, size_t size, int slot, float* values, int maxValues)
+{
+    if (slot < 0 || slot >= maxSnapshots || read(data, size, values, 0) < 0)
+        return -1;
+
+    const auto* in = static_cast<const std::uint8_t*>(data);
+    const int numValues = in[6] | (in[7] << 8);
+    const size_t sectionStart = getSize(numValues);
+    if (size < sectionStart + 2)
+        return -1;
+
+    const int mask = in[sectionStart] | (in[sectionStart + 1] << 8);
+    if ((mask & (1 << slot)) == 0)
+        return -1;
+
+    // Skip the snapshots stored before this one
+    int preceding = 0;
+    for (int s = 0; s < slot; ++s)
+        preceding += (mask >> s) & 1;
+
+    in += sectionStart + 2 + 4 * static_cast<size_t>(preceding * numValues);
+    if (static_cast<size_t>(in - static_cast<const std::uint8_t*>(data)) + 4 * static_cast<size_t>(numValues) > size)
+        return -1;
+
+    const int count = numValues < maxValues ? numValues : maxValues;
+    for (int i = 0; i < count; ++i, in += 4)
+        values[i] = readFloat(in);
+    return count;
+}
+} // namespace CinderState
@@ -0,0 +1,309 @@
+#pragma once
+
+#include "SampleStorage.h"
+#include "SimdFloat.h"
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+/**
+ * SampleBuffer - Flat sample array in a SampleStorage format
+ *
+ * float32 samples live in a float vector, float16 / int16 in a 16-bit one
+ * (only one is allocated). read() / write() convert one sample at a time.
+ */
+class SampleBuffer
+{
+public:
+    SampleBuffer() = default;
+    explicit SampleBuffer(int numSamples, SampleStorage format = SampleStorage::float32) { allocate(numSamples, format); }
+
+    void allocate(int numSamples, SampleStorage newStorage)
+    {
+        storage = newStorage;
+        length = std::max(0, numSamples);
+        if (storage == SampleStorage::float32)
+        {
+            packed = {};
+            floats.assign(static_cast<size_t>(length), 0.0f);
+        }
+        else
+        {
+            floats = {};
+            packed.assign(static_cast<size_t>(length), 0);
+        }
+    }
+
+    // Frees the samples (size 0 until the next allocate)
+    void release()
+    {
+        floats = std::vector<float>();
+        packed = std::vector<std::uint16_t>();
+        length = 0;
+    }
+
+    void clear()
+    {
+        std::fill(floats.begin(), floats.end(), 0.0f);
+        std::fill(packed.begin(), packed.end(), std::uint16_t { 0 });
+    }
+
+    int size() const { return length; }
+    SampleStorage getStorage() const { return storage; }
+
+    float read(int index) const
+    {
+        const auto i = static_cast<size_t>(index);
+        if (storage == SampleStorage::float32)
+            return floats[i];
+        if (storage == SampleStorage::float16)
+            return SampleCodec::halfToFloat(packed[i]);
+        return SampleCodec::int16ToFloat(static_cast<std::int16_t>(packed[i]));
+    }
+
+    void write(int index, float sample)
+    {
+        const auto i = static_cast<size_t>(index);
+        if (storage == SampleStorage::float32)
+            floats[i] = sample;
+        else if (storage == SampleStorage::float16)
+            packed[i] = SampleCodec::floatToHalf(sample);
+        else
+            packed[i] = static_cast<std::uint16_t>(SampleCodec::floatToInt16(sample));
+    }
+
+    // Contiguous runs (no wrapping): a straight copy for float32, one
+    // conversion per sample for the packed formats
+    void readRange(int start, int count, float* out) const
+    {
+        if (storage == SampleStorage::float32)
+            std::copy_n(floats.begin() + start, count, out);
+        else
+            for (int i = 0; i < count; ++i)
+                out[i] = read(start + i);
+    }
+
+    void writeRange(int start, int count, const float* samples)
+    {
+        if (storage == SampleStorage::float32)
+            std::copy_n(samples, count, floats.begin() + start);
+        else
+            for (int i = 0; i < count; ++i)
+                write(start + i, samples[i]);
+    }
+
+private:
+    SampleStorage storage = SampleStorage::float32;
+    int length = 0;
+    std::vector<float> floats;
+    std::vector<std::uint16_t> packed;
+};
+
+/**
+ * DelayBuffer - Single-channel fractional delay line
+ *
+ * Drop-in for the juce::dsp::DelayLine<float, Linear> calls the reverb used,
+ * so the DSP headers build without JUCE:
+ * - popSample(d) reads the sample pushed d samples ago (clamped to the maximum)
+ * - pushSample(x) writes the next sample
+ *
+ * Also offers an integer-tap read (no interpolation at all) for delays that
+ * are known to be static, and a 4-point cubic read for modulated delays
+ * where linear interpolation's high-frequency loss is audible.
+ *
+ * Block access: when a delay is at least as long as the block, every sample
+ * the block reads was pushed before it started, so a whole block of taps can
+ * be read up front (popBlock / readIntegerBlock), processed with vector code,
+ * and pushed back in one go (pushBlock). Results match sample-by-sample
+ * processing exactly.
+ *
+ * Storage is a power-of-two ring, so wrapping is a mask instead of a modulo,
+ * in any SampleStorage format (float by default; float16 / int16 halve the
+ * memory the line cycles through).
+ *
+ * reset() is O(1): instead of zero-filling the ring it forgets how much of it
+ * has been written. Reads that reach back past the last reset return 0, and
+ * once the ring has been written all the way round every read is live again,
+ * so the output is exactly that of a cleared line, with the clearing spread
+ * over the writes that happen anyway.
+ * All memory is allocated in prepare() (a line holds none before it, so
+ * constructing one is free); pop/push never allocate.
+ */
+class DelayBuffer
+{
+public:
+    enum class Interpolation
+    {
+        linear = 0,
+        cubic       // 4-point Catmull-Rom
+    };
+
+    DelayBuffer() = default;
+
+    void prepare(int maxDelayInSamples, SampleStorage storage = SampleStorage::float32)
+    {
+        maxDelay = std::max(0, maxDelayInSamples);
+
+        // +2: one slot for the sample being written, one for the interpolation partner
+        int size = 4;
+        while (size < maxDelay + 2)
+            size <<= 1;
+
+        buffer.allocate(size, storage);
+        mask = size - 1;
+        writePos = 0;
+        written = size;   // allocated as zeros
+    }
+
+    // Marks the whole ring stale (nothing is cleared)
+    void reset()
+    {
+        writePos = 0;
+        written = 0;
+    }
+
+    // Frees the line; prepare() again before using it
+    void release()
+    {
+        buffer.release();
+        mask = 0;
+        writePos = 0;
+        written = 0;
+        maxDelay = 0;
+    }
+
+    int getMaximumDelayInSamples() const { return maxDelay; }
+
+    float popSample(float delayInSamples) const
+    {
+        const float delay = std::clamp(delayInSamples, 0.0f, static_cast<float>(maxDelay));
+        const int delayInt = static_cast<int>(delay);
+        const float delayFrac = delay - static_cast<float>(delayInt);
+
+        const float value1 = readBack(delayInt);
+        const float value2 = readBack(delayInt + 1);
+        return value1 + delayFrac * (value2 - value1);
+    }
+
+    // Whole-sample delay: one load, no fractional maths
+    float readInteger(int delayInSamples) const
+    {
+        return readBack(delayInSamples);
+    }
+
+    // Needs a sample of history either side of the tap, so the usable range
+    // is 2 .. maximum - 1
+    float popSampleCubic(float delayInSamples) const
+    {
+        const float delay = std::clamp(delayInSamples, 2.0f, static_cast<float>(std::max(2, maxDelay - 1)));
+        const int delayInt = static_cast<int>(delay);
+        const float t = delay - static_cast<float>(delayInt);
+
+        float ym1, y0, y1, y2;
+        readCubicTaps(delayInt, ym1, y0, y1, y2);
+
+        const float c1 = 0.5f * (y1 - ym1);
+        const float c2 = ym1 - 2.5f * y0 + 2.0f * y1 - 0.5f * y2;
+        const float c3 = 0.5f * (y2 - ym1) + 1.5f * (y0 - y1);
+        return ((c3 * t + c2) * t + c1) * t + y0;
+    }
+
+    // The four samples popSampleCubic() interpolates between, newest to oldest
+    // (the tap sits between y0 and y1, as in popSample()), for callers that
+    // interpolate several lines at once. delayInSamples must be 2 .. maximum - 1.
+    void readCubicTaps(int delayInSamples, float& ym1, float& y0, float& y1, float& y2) const
+    {
+        ym1 = readBack(delayInSamples - 1);
+        y0 = readBack(delayInSamples);
+        y1 = readBack(delayInSamples + 1);
+        y2 = readBack(delayInSamples + 2);
+    }
+
+    float popSample(float delayInSamples, Interpolation interpolation) const
+    {
+        return interpolation == Interpolation::cubic ? popSampleCubic(delayInSamples) : popSample(delayInSamples);
+    }
+
+    void pushSample(float sample)
+    {
+        buffer.write(writePos, sample);
+        writePos = (writePos + 1) & mask;
+        if (written <= mask)
+            ++written;
+    }
+
+    // popSample() for the next numSamples samples at a fixed delay, which
+    // must be >= numSamples (and the block no longer than the line)
+    void popBlock(float delayInSamples, float* out, int numSamples) const
+    {
+        const float delay = std::clamp(delayInSamples, 0.0f, static_cast<float>(maxDelay));
+        const int delayInt = static_cast<int>(delay);
+        const float delayFrac = delay - static_cast<float>(delayInt);
+        const SimdFloat fraction = SimdFloat::broadcast(delayFrac);
+
+        // out[k] starts as the older interpolation partner of tap k, which is
+        // the newer partner of tap k - 1, so the lerp can run in place upwards
+        readRing((writePos - delayInt - 1) & mask, numSamples, out);
+        clearStale(delayInt + 1, out, numSamples);
+
+        int k = 0;
+        for (; k + SimdFloat::width < numSamples; k += SimdFloat::width)
+        {
+            const SimdFloat value1 = SimdFloat::load(out + k + 1);
+            const SimdFloat value2 = SimdFloat::load(out + k);
+            (value1 + fraction * (value2 - value1)).store(out + k);
+        }
+        for (; k < numSamples; ++k)
+        {
+            const float value1 = k + 1 < numSamples ? out[k + 1] : readBack(delayInt - k);
+            out[k] = value1 + delayFrac * (out[k] - value1);
+        }
+    }
+
+    // readInteger() for the next numSamples samples (delay >= numSamples)
+    void readIntegerBlock(int delayInSamples, float* out, int numSamples) const
+    {
+        readRing((writePos - delayInSamples) & mask, numSamples, out);
+        clearStale(delayInSamples, out, numSamples);
+    }
+
+    void pushBlock(const float* samples, int numSamples)
+    {
+        const int first = std::min(numSamples, mask + 1 - writePos);
+        buffer.writeRange(writePos, first, samples);
+        buffer.writeRange(0, numSamples - first, samples + first);
+        writePos = (writePos + numSamples) & mask;
+        written = std::min(written + numSamples, mask + 1);
+    }
+
+private:
+    // The sample pushed distance samples ago, or 0 if that slot was written
+    // before the last reset. Distance 0 (the slot about to be written) is
+    // the oldest one in the ring.
+    float readBack(int distance) const
+    {
+        return ((distance - 1) & mask) < written ? buffer.read((writePos - distance) & mask) : 0.0f;
+    }
+
+    // out[k] was read from distance - k: zeroes the leading entries that reach
+    // back past the last reset (block reads never cover distance 0)
+    void clearStale(int distance, float* out, int numSamples) const
+    {
+        if (distance > written)
+            std::fill_n(out, std::min(numSamples, distance - written), 0.0f);
+    }
+
+    // numSamples consecutive samples from ring index start, wrapping once at most
+    void readRing(int start, int numSamples, float* out) const
+    {
+        const int first = std::min(numSamples, mask + 1 - start);
+        buffer.readRange(start, first, out);
+        buffer.readRange(0, numSamples - first, out + first);
+    }
+
+    SampleBuffer buffer;
+    int mask = 0;
+    int writePos = 0;
+    int written = 0;   // slots written since the last reset, up to the ring size
+    int maxDelay = 0;
+};
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "PresetBank.h"
+#include <iterator>
+
+/**
+ * FactoryPresets - The factory bank, built into the binary as a PresetBank image
+ *
+ * Values in BasicCinderEngine::Param order:
+ *   drive, decay, shimmer, burn, size, duck, mix, freeze, low decay, high decay, mod, morph
+ */
+namespace FactoryPresets
+{
+inline constexpr int numValues = 12;
+
+inline constexpr float init[numValues]            { 0.0f,  2.0f, 0.0f, 0.0f, 0.5f, 0.0f, 0.3f,  0.0f, 1.0f, 1.0f, 0.0f, 0.0f };
+inline constexpr float glassCathedral[numValues]  { 0.0f,  8.0f, 0.6f, 0.0f, 0.9f, 0.0f, 0.4f,  0.0f, 1.2f, 0.8f, 0.3f, 0.0f };
+inline constexpr float emberHall[numValues]       { 0.2f,  5.0f, 0.3f, 0.3f, 0.7f, 0.2f, 0.35f, 0.0f, 1.5f, 0.7f, 0.2f, 0.0f };
+inline constexpr float burntRoom[numValues]       { 0.4f,  1.2f, 0.0f, 0.7f, 0.3f, 0.0f, 0.35f, 0.0f, 1.0f, 0.6f, 0.0f, 0.0f };
+inline constexpr float duckedPlate[numValues]     { 0.0f,  2.5f, 0.0f, 0.0f, 0.4f, 0.7f, 0.4f,  0.0f, 0.8f, 1.3f, 0.1f, 0.0f };
+inline constexpr float darkTail[numValues]        { 0.1f,  6.0f, 0.0f, 0.1f, 0.6f, 0.0f, 0.3f,  0.0f, 2.0f, 0.4f, 0.2f, 0.0f };
+inline constexpr float endlessShimmer[numValues]  { 0.0f, 30.0f, 0.7f, 0.0f, 0.8f, 0.0f, 0.5f,  0.0f, 1.0f, 0.5f, 0.4f, 0.0f };
+inline constexpr float scorchedEarth[numValues]   { 0.8f,  4.0f, 0.4f, 1.0f, 1.0f, 0.3f, 0.45f, 0.0f, 0.7f, 0.5f, 0.0f, 0.0f };
+
+inline constexpr PresetBank::Preset presets[] {
+    { "Init",            init },
+    { "Glass Cathedral", glassCathedral },
+    { "Ember Hall",      emberHall },
+    { "Burnt Room",      burntRoom },
+    { "Ducked Plate",    duckedPlate },
+    { "Dark Tail",       darkTail },
+    { "Endless Shimmer", endlessShimmer },
+    { "Scorched Earth",  scorchedEarth },
+};
+
+inline constexpr auto bankImage = PresetBank::makeImage<std::size(presets), numValues>(presets);
+} // namespace FactoryPresets
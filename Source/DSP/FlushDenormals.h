@@ -0,0 +1,46 @@
+#pragma once
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+ #include <xmmintrin.h>
+ #define CINDER_HAS_MXCSR 1
+#endif
+
+/**
+ * FlushDenormals - RAII flush-to-zero / denormals-are-zero for the current thread
+ *
+ * JUCE-free counterpart of juce::ScopedNoDenormals for embedded hosts that call
+ * the DSP core directly. No-op on targets without a control register we know.
+ */
+class FlushDenormals
+{
+public:
+    FlushDenormals()
+    {
+       #if CINDER_HAS_MXCSR
+        savedState = _mm_getcsr();
+        _mm_setcsr(savedState | 0x8040); // FTZ | DAZ
+       #elif defined(__aarch64__)
+        asm volatile("mrs %0, fpcr" : "=r"(savedState));
+        asm volatile("msr fpcr, %0" : : "r"(savedState | (1ull << 24))); // FZ
+       #endif
+    }
+
+    ~FlushDenormals()
+    {
+       #if CINDER_HAS_MXCSR
+        _mm_setcsr(savedState);
+       #elif defined(__aarch64__)
+        asm volatile("msr fpcr, %0" : : "r"(savedState));
+       #endif
+    }
+
+    FlushDenormals(const FlushDenormals&) = delete;
+    FlushDenormals& operator=(const FlushDenormals&) = delete;
+
+private:
+   #if CINDER_HAS_MXCSR
+    unsigned int savedState = 0;
+   #else
+    unsigned long long savedState = 0;
+   #endif
+};
@@ -0,0 +1,157 @@
+#include "Kernels.h"
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+
+#if CINDER_X86_KERNELS
+ #if defined(_MSC_VER)
+  #include <intrin.h>
+ #else
+  #include <cpuid.h>
+ #endif
+#endif
+
+namespace kernels_generic { const CinderKernels& getKernelTable(); }
+#if CINDER_X86_KERNELS
+namespace kernels_avx2 { const CinderKernels& getKernelTable(); }
+namespace kernels_avx512 { const CinderKernels& getKernelTable(); }
+#endif
+
+namespace
+{
+std::atomic<int> forcedLevel { -1 };
+
+#if CINDER_X86_KERNELS
+void cpuid(int leaf, int subleaf, unsigned int regs[4])
+{
+ #if defined(_MSC_VER)
+    int r[4];
+    __cpuidex(r, leaf, subleaf);
+    for (int i = 0; i < 4; ++i)
+        regs[i] = static_cast<unsigned int>(r[i]);
+ #else
+    __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+ #endif
+}
+
+// XCR0: which register states the OS saves on context switch
+unsigned long long readXcr0()
+{
+ #if defined(_MSC_VER)
+    return _xgetbv(0);
+ #else
+    unsigned int eax, edx;
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return (static_cast<unsigned long long>(edx) << 32) | eax;
+ #endif
+}
+
+SimdLevel detect()
+{
+    unsigned int regs[4];
+    cpuid(0, 0, regs);
+    const unsigned int maxLeaf = regs[0];
+    if (maxLeaf < 7)
+        return SimdLevel::generic;
+
+    cpuid(1, 0, regs);
+    const bool osxsave = (regs[2] & (1u << 27)) != 0;
+    const bool avx = (regs[2] & (1u << 28)) != 0;
+    const bool fma = (regs[2] & (1u << 12)) != 0;
+    const bool f16c = (regs[2] & (1u << 29)) != 0;
+    if (! (osxsave && avx && fma && f16c))
+        return SimdLevel::generic;
+
+    const unsigned long long xcr0 = readXcr0();
+    const bool ymmSaved = (xcr0 & 0x6) == 0x6;
+    const bool zmmSaved = (xcr0 & 0xe6) == 0xe6;
+
+    cpuid(7, 0, regs);
+    const bool avx2 = (regs[1] & (1u << 5)) != 0;
+    const bool avx512f = (regs[1] & (1u << 16)) != 0;
+
+    if (avx512f && avx2 && zmmSaved)
+        return SimdLevel::avx512;
+    if (avx2 && ymmSaved)
+        return SimdLevel::avx2;
+    return SimdLevel::generic;
+}
+#else
+SimdLevel detect() { return SimdLevel::generic; }
+#endif
+
+int parseLevel(const char* name)
+{
+    for (auto level : { SimdLevel::generic, SimdLevel::avx2, SimdLevel::avx512 })
+        if (std::strcmp(name, getSimdLevelName(level)) == 0)
+            return static_cast<int>(level);
+    return std::strcmp(name, "sse2") == 0 || std::strcmp(name, "scalar") == 0 ? 0 : -1;
+}
+
+// CINDER_SIMD, read once
+int environmentLevel()
+{
+    static const int level = [] {
+        const char* value = std::getenv("CINDER_SIMD");
+        const int parsed = value != nullptr ? parseLevel(value) : -1;
+        return parsed >= 0 && isSimdLevelSupported(static_cast<SimdLevel>(parsed)) ? parsed : -1;
+    }();
+    return level;
+}
+} // namespace
+
+SimdLevel detectSimdLevel()
+{
+    static const SimdLevel level = detect();
+    return level;
+}
+
+bool isSimdLevelSupported(SimdLevel level)
+{
+    return static_cast<int>(level) >= 0 && static_cast<int>(level) <= static_cast<int>(detectSimdLevel());
+}
+
+bool forceSimdLevel(SimdLevel level)
+{
+    if (! isSimdLevelSupported(level))
+        return false;
+
+    forcedLevel.store(static_cast<int>(level));
+    return true;
+}
+
+void clearForcedSimdLevel()
+{
+    forcedLevel.store(-1);
+}
+
+SimdLevel getActiveSimdLevel()
+{
+    if (const int forced = forcedLevel.load(); forced >= 0)
+        return static_cast<SimdLevel>(forced);
+    if (const int fromEnvironment = environmentLevel(); fromEnvironment >= 0)
+        return static_cast<SimdLevel>(fromEnvironment);
+    return detectSimdLevel();
+}
+
+const CinderKernels& getKernels()
+{
+    switch (getActiveSimdLevel())
+    {
+#if CINDER_X86_KERNELS
+        case SimdLevel::avx512: return kernels_avx512::getKernelTable();
+        case SimdLevel::avx2:   return kernels_avx2::getKernelTable();
+#endif
+        default:                return kernels_generic::getKernelTable();
+    }
+}
+
+const char* getSimdLevelName(SimdLevel level)
+{
+    switch (level)
+    {
+        case SimdLevel::avx2:   return "avx2";
+        case SimdLevel::avx512: return "avx512";
+        default:                return "generic";
+    }
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "../ShimmerBatchState.h"
+
+/**
+ * Kernels - Hot DSP kernels compiled for several instruction sets, with
+ * runtime selection by CPUID
+ *
+ *   Kernels_Generic.cpp  baseline flags (SSE2 on x86-64, scalar elsewhere)
+ *   Kernels_AVX2.cpp     AVX2 + FMA + F16C   (x86 builds only)
+ *   Kernels_AVX512.cpp   AVX-512F + F16C     (x86 builds only)
+ *
+ * getKernels() is meant to be called from prepare(); components keep the
+ * returned table for their lifetime, so a forced level takes effect at the
+ * next prepare. The level can be forced with forceSimdLevel() or the
+ * CINDER_SIMD environment variable (generic, avx2, avx512) for benchmarks;
+ * levels the CPU lacks are never selected.
+ */
+
+enum class SimdLevel
+{
+    generic = 0,
+    avx2,
+    avx512
+};
+
+struct BlockScan
+{
+    bool nonFinite;   // any NaN or infinity
+    bool subnormal;   // any denormal (nonzero below FLT_MIN)
+};
+
+struct CinderKernels
+{
+    SimdLevel level;
+    int width;   // floats per register; sets ShimmerBatchState's memory layout
+
+    // ShimmerReverbBatch block on lane-interleaved frames (in place)
+    void (*shimmerBatch)(ShimmerBatchState& state, float* io, int numSamples);
+
+    // Peak |x| of a block
+    float (*peakAbs)(const float* samples, int numSamples);
+
+    // Accumulates peak and sum of squares of (left + right) * 0.5
+    void (*measureStereo)(const float* left, const float* right, int numSamples, float& peak, float& sumSquares);
+
+    // Non-finite and subnormal samples in a block
+    BlockScan (*scanBlock)(const float* samples, int numSamples);
+};
+
+// Best level this CPU (and OS) supports, detected once
+SimdLevel detectSimdLevel();
+bool isSimdLevelSupported(SimdLevel level);
+
+// Forces a level for subsequent getKernels() calls. Returns false (and
+// changes nothing) if this CPU or build cannot run it.
+bool forceSimdLevel(SimdLevel level);
+void clearForcedSimdLevel();
+
+// Forced level, else CINDER_SIMD, else the detected level
+SimdLevel getActiveSimdLevel();
+const CinderKernels& getKernels();
+
+const char* getSimdLevelName(SimdLevel level);
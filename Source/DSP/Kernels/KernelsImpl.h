@@ -0,0 +1,339 @@
+#pragma once
+
+/**
+ * KernelsImpl - Kernel bodies, compiled once per instruction set
+ *
+ * Included only by the Kernels_*.cpp translation units, each of which defines
+ * CINDER_KERNEL_NAMESPACE first and is compiled with its own ISA flags. All
+ * code here lives in that namespace, so the AVX2 and AVX-512 copies of a
+ * kernel never share a symbol with each other or with baseline code.
+ *
+ * Keep to SimdFloat, plain arrays and pointers: calling inline std:: functions
+ * from here would emit ISA-specific copies the linker may pick for the whole
+ * program.
+ */
+
+#ifndef CINDER_KERNEL_NAMESPACE
+ #error "define CINDER_KERNEL_NAMESPACE before including KernelsImpl.h"
+#endif
+
+#include "Kernels.h"
+#include "../SimdFloat.h"
+#include <cstring>
+
+namespace CINDER_KERNEL_NAMESPACE
+{
+
+using V = SimdFloat;
+using VInt = SimdInt;
+
+constexpr int width = V::width;
+constexpr int log2Width = width == 16 ? 4 : width == 8 ? 3 : width == 4 ? 2 : width == 2 ? 1 : 0;
+static_assert(ShimmerBatchState::numLanes % width == 0, "lane count must be a multiple of the SIMD width");
+
+// Pade approximant of tanh, within 1e-4 of std::tanh (input clamped to +-5)
+inline V fastTanh(V x)
+{
+    x = min(max(x, V::broadcast(-5.0f)), V::broadcast(5.0f));
+    const V x2 = x * x;
+    const V num = x * (V::broadcast(135135.0f) + x2 * (V::broadcast(17325.0f) + x2 * (V::broadcast(378.0f) + x2)));
+    const V den = V::broadcast(135135.0f) + x2 * (V::broadcast(62370.0f) + x2 * (V::broadcast(3150.0f) + x2 * V::broadcast(28.0f)));
+    return num / den;
+}
+
+// Branchless softLimit: identity below 0.8, tanh knee above.
+// Below the threshold the excess is 0, so the sum is just |x|.
+inline V softLimit(V x)
+{
+    const V threshold = V::broadcast(0.8f);
+    const V ax = abs(x);
+    const V excess = max(ax - threshold, V::broadcast(0.0f));
+    return copysign(min(ax, threshold) + V::broadcast(0.2f) * fastTanh(excess * V::broadcast(2.0f)), x);
+}
+
+// 8-point fast Walsh-Hadamard transform (unnormalised, 24 adds)
+inline void hadamard8(V* x)
+{
+    for (int h = 1; h < 8; h <<= 1)
+        for (int i = 0; i < 8; i += h << 1)
+            for (int j = i; j < i + h; ++j)
+            {
+                const V u = x[j];
+                const V v = x[j + h];
+                x[j] = u + v;
+                x[j + h] = u - v;
+            }
+}
+
+// Delay memory formats (see SampleStorage.h): element type and conversions
+struct Float32Memory
+{
+    using Sample = float;
+    static V load(const Sample* p) { return V::load(p); }
+    static void store(V x, Sample* p) { x.store(p); }
+    static V gather(const Sample* base, VInt idx) { return V::gather(base, idx); }
+};
+
+struct Float16Memory
+{
+    using Sample = std::uint16_t;
+    static V load(const Sample* p) { return V::loadHalf(p); }
+    static void store(V x, Sample* p) { x.storeHalf(p); }
+    static V gather(const Sample* base, VInt idx) { return V::gatherHalf(base, idx); }
+};
+
+struct Int16Memory
+{
+    using Sample = std::int16_t;
+    static V load(const Sample* p) { return V::loadInt16(p); }
+    static void store(V x, Sample* p) { x.storeInt16(p); }
+    static V gather(const Sample* base, VInt idx) { return V::gatherInt16(base, idx); }
+};
+
+// Dual-grain overlap-add (+1 octave) on one lane group
+template <typename Memory>
+inline V processPitchShift(ShimmerBatchState& state, typename Memory::Sample* mem, V input)
+{
+    constexpr float pitchRatio = 2.0f;
+    constexpr int grainSize = ShimmerBatchState::grainSize;
+    auto& pos = state.positions;
+    const int frames = state.pitchFrames;
+
+    Memory::store(input, mem + pos.pitchWrite * width);
+    pos.pitchWrite = (pos.pitchWrite + 1) % frames;
+
+    V output = V::broadcast(0.0f);
+    for (int g = 0; g < 2; ++g)
+    {
+        pos.grainReadPos[g] += pitchRatio;
+        if (pos.grainReadPos[g] >= static_cast<float>(frames))
+            pos.grainReadPos[g] -= static_cast<float>(frames);
+
+        const int readIdx = static_cast<int>(pos.grainReadPos[g]);
+        const float frac = pos.grainReadPos[g] - static_cast<float>(readIdx);
+        const V a = Memory::load(mem + readIdx * width);
+        const V b = Memory::load(mem + ((readIdx + 1) % frames) * width);
+        output = output + (a * V::broadcast(1.0f - frac) + b * V::broadcast(frac)) * V::broadcast(state.grainWindow[pos.grainPhase[g]]);
+
+        // Advance grain phase, reset grain when it completes
+        if (++pos.grainPhase[g] >= grainSize)
+        {
+            pos.grainPhase[g] = 0;
+            pos.grainReadPos[g] = static_cast<float>((pos.pitchWrite - grainSize + frames) % frames);
+        }
+    }
+    return output;
+}
+
+// One register-wide lane group for a whole block, state held in registers
+template <typename Memory>
+inline void processShimmerGroup(ShimmerBatchState& state, float* io, int numSamples, int group)
+{
+    constexpr int numLanes = ShimmerBatchState::numLanes;
+    constexpr int numLines = ShimmerBatchState::numLines;
+    constexpr int numDiffusers = ShimmerBatchState::numDiffusers;
+
+    const int c0 = group * width;
+    const int fdnFrames = state.fdnFrames;
+    const int diffuserFrames = state.diffuserFrames;
+    const int fdnMask = fdnFrames - 1;
+    const int diffuserMask = diffuserFrames - 1;
+
+    using Sample = typename Memory::Sample;
+    Sample* fdn = static_cast<Sample*>(state.fdnMemory) + static_cast<long long>(group) * numLines * fdnFrames * width;
+    float* diffusers = state.diffuserMemory + static_cast<long long>(group) * numDiffusers * diffuserFrames * width;
+    Sample* pitch = static_cast<Sample*>(state.pitchMemory) + static_cast<long long>(group) * state.pitchFrames * width;
+
+    const auto& current = state.current;
+    const auto& step = state.step;
+    V loopGain = V::load(current.loopGain + c0), loopGainStep = V::load(step.loopGain + c0);
+    V damping = V::load(current.damping + c0), dampingStep = V::load(step.damping + c0);
+    V burnGain = V::load(current.burnGain + c0), burnGainStep = V::load(step.burnGain + c0);
+    V shimmerSend = V::load(current.shimmerSend + c0), shimmerSendStep = V::load(step.shimmerSend + c0);
+
+    V delay[numLines], delayStep[numLines], lowpass[numLines];
+    for (int i = 0; i < numLines; ++i)
+    {
+        delay[i] = V::load(current.delay[i] + c0);
+        delayStep[i] = V::load(step.delay[i] + c0);
+        lowpass[i] = V::load(state.dampingFilters[i] + c0);
+    }
+
+    const V diffuserGain = V::broadcast(0.6f);
+    const V norm = V::broadcast(0.35355339f);   // 1 / sqrt(numLines)
+    const V inputScale = V::broadcast(1.0f / static_cast<float>(numLines));
+    const VInt laneIndex = VInt::iota();
+    const VInt maskVec = VInt::broadcast(fdnMask);
+    const VInt one = VInt::broadcast(1);
+
+    auto& pos = state.positions;
+
+    for (int s = 0; s < numSamples; ++s)
+    {
+        float* frame = io + s * numLanes + c0;
+        V x = V::load(frame);
+
+        loopGain = loopGain + loopGainStep;
+        damping = damping + dampingStep;
+        burnGain = burnGain + burnGainStep;
+        shimmerSend = shimmerSend + shimmerSendStep;
+
+        // 1. Input diffusion: lane-uniform delays -> contiguous loads
+        for (int d = 0; d < numDiffusers; ++d)
+        {
+            float* mem = diffusers + d * diffuserFrames * width;
+            const int delayInt = state.diffuserDelayInt[d];
+            const V a = V::load(mem + ((pos.diffuserWrite - delayInt) & diffuserMask) * width);
+            const V b = V::load(mem + ((pos.diffuserWrite - delayInt - 1) & diffuserMask) * width);
+            const V delayed = a + V::broadcast(state.diffuserDelayFrac[d]) * (b - a);
+            (x + delayed * diffuserGain).store(mem + pos.diffuserWrite * width);
+            x = delayed - x * diffuserGain;
+        }
+        pos.diffuserWrite = (pos.diffuserWrite + 1) & diffuserMask;
+
+        // 2. FDN reads: per-lane delays -> gathers
+        V lineOut[numLines];
+        const VInt writePos = VInt::broadcast(pos.fdnWrite);
+        for (int i = 0; i < numLines; ++i)
+        {
+            delay[i] = delay[i] + delayStep[i];
+            const VInt di = delay[i].truncated();
+            const V frac = delay[i] - V::fromInt(di);
+            const VInt idxA = ((writePos - di) & maskVec).shiftedLeft(log2Width) + laneIndex;
+            const VInt idxB = ((writePos - di - one) & maskVec).shiftedLeft(log2Width) + laneIndex;
+            const Sample* mem = fdn + i * fdnFrames * width;
+            const V va = Memory::gather(mem, idxA);
+            const V vb = Memory::gather(mem, idxB);
+            lineOut[i] = va + frac * (vb - va);
+        }
+
+        // 3. Hadamard mixing (normalised in the damping step)
+        V mixed[numLines];
+        for (int i = 0; i < numLines; ++i)
+            mixed[i] = lineOut[i];
+        hadamard8(mixed);
+
+        // 4. Damping, BURN, soft limiting and loop gain
+        V shimmerIn = V::broadcast(0.0f);
+        for (int i = 0; i < numLines; ++i)
+        {
+            lowpass[i] = lowpass[i] + damping * (mixed[i] * norm - lowpass[i]);
+            mixed[i] = softLimit(lowpass[i] * burnGain) * loopGain;
+            shimmerIn = shimmerIn + mixed[i];
+        }
+
+        // 5. Shimmer: grain positions are shared by every lane
+        const V pitched = processPitchShift<Memory>(state, pitch, shimmerIn * V::broadcast(0.125f));
+
+        // 6. Write lines (feedback + input + shimmer) with the safety limiter
+        const V inputContribution = x * inputScale;
+        const V shimmerContribution = pitched * shimmerSend;
+        for (int i = 0; i < numLines; ++i)
+            Memory::store(softLimit(mixed[i] + inputContribution + shimmerContribution),
+                          fdn + (i * fdnFrames + pos.fdnWrite) * width);
+        pos.fdnWrite = (pos.fdnWrite + 1) & fdnMask;
+
+        // 7. Output: sum of the line reads
+        V sum = lineOut[0];
+        for (int i = 1; i < numLines; ++i)
+            sum = sum + lineOut[i];
+        (sum * V::broadcast(0.25f)).store(frame);
+    }
+
+    for (int i = 0; i < numLines; ++i)
+        lowpass[i].store(state.dampingFilters[i] + c0);
+}
+
+template <typename Memory>
+inline void processShimmerGroups(ShimmerBatchState& state, float* io, int numSamples)
+{
+    // Groups never interact; the shared positions advance identically for each
+    const ShimmerBatchState::Positions start = state.positions;
+    for (int group = 0; group < ShimmerBatchState::numLanes / width; ++group)
+    {
+        state.positions = start;
+        processShimmerGroup<Memory>(state, io, numSamples, group);
+    }
+}
+
+inline void processShimmerBatch(ShimmerBatchState& state, float* io, int numSamples)
+{
+    switch (state.storage)
+    {
+        case SampleStorage::float16: processShimmerGroups<Float16Memory>(state, io, numSamples); break;
+        case SampleStorage::int16:   processShimmerGroups<Int16Memory>(state, io, numSamples); break;
+        case SampleStorage::float32:
+        default:                     processShimmerGroups<Float32Memory>(state, io, numSamples); break;
+    }
+}
+
+// Peak |x| over a block
+inline float peakAbs(const float* samples, int numSamples)
+{
+    V peak = V::broadcast(0.0f);
+    int i = 0;
+    for (; i + width <= numSamples; i += width)
+        peak = max(peak, abs(V::load(samples + i)));
+
+    float result = peak.reduceMax();
+    for (; i < numSamples; ++i)
+    {
+        const float a = samples[i] < 0.0f ? -samples[i] : samples[i];
+        result = a > result ? a : result;
+    }
+    return result;
+}
+
+// Peak and sum of squares of the mono sum (left + right) * 0.5
+inline void measureStereo(const float* left, const float* right, int numSamples, float& peak, float& sumSquares)
+{
+    const V half = V::broadcast(0.5f);
+    V peakVec = V::broadcast(0.0f);
+    V sumVec = V::broadcast(0.0f);
+    int i = 0;
+    for (; i + width <= numSamples; i += width)
+    {
+        const V mono = (V::load(left + i) + V::load(right + i)) * half;
+        peakVec = max(peakVec, abs(mono));
+        sumVec = sumVec + mono * mono;
+    }
+
+    float blockPeak = peakVec.reduceMax();
+    float blockSum = sumVec.reduceSum();
+    for (; i < numSamples; ++i)
+    {
+        const float mono = (left[i] + right[i]) * 0.5f;
+        const float a = mono < 0.0f ? -mono : mono;
+        blockPeak = a > blockPeak ? a : blockPeak;
+        blockSum += mono * mono;
+    }
+
+    peak = blockPeak > peak ? blockPeak : peak;
+    sumSquares += blockSum;
+}
+
+// NaN / infinity and subnormals anywhere in a block. Branch-free bit tests
+// OR-reduced over the block, which the compiler vectorises at this TU's ISA.
+inline BlockScan scanBlock(const float* samples, int numSamples)
+{
+    std::uint32_t nonFinite = 0, subnormal = 0;
+    for (int i = 0; i < numSamples; ++i)
+    {
+        std::uint32_t bits;
+        std::memcpy(&bits, samples + i, sizeof(bits));
+        bits &= 0x7fffffffu;
+        nonFinite |= static_cast<std::uint32_t>(bits >= 0x7f800000u);
+        subnormal |= static_cast<std::uint32_t>(bits - 1u < 0x007fffffu);   // 0 wraps around
+    }
+    return { nonFinite != 0, subnormal != 0 };
+}
+
+// Defined by the including Kernels_*.cpp
+const CinderKernels& getKernelTable();
+
+inline constexpr CinderKernels makeKernelTable(SimdLevel level)
+{
+    return { level, width, &processShimmerBatch, &peakAbs, &measureStereo, &scanBlock };
+}
+
+} // namespace CINDER_KERNEL_NAMESPACE
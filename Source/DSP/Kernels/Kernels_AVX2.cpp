@@ -0,0 +1,11 @@
+// Compiled with AVX2 + FMA + F16C (see CMakeLists.txt); only selected after CPUID confirms support
+#define CINDER_KERNEL_NAMESPACE kernels_avx2
+#include "KernelsImpl.h"
+
+static_assert(kernels_avx2::width == 8, "Kernels_AVX2.cpp must be compiled with AVX2 enabled");
+
+const CinderKernels& kernels_avx2::getKernelTable()
+{
+    static constexpr CinderKernels table = makeKernelTable(SimdLevel::avx2);
+    return table;
+}
@@ -0,0 +1,11 @@
+// Compiled with AVX-512F + F16C (see CMakeLists.txt); only selected after CPUID confirms support
+#define CINDER_KERNEL_NAMESPACE kernels_avx512
+#include "KernelsImpl.h"
+
+static_assert(kernels_avx512::width == 16, "Kernels_AVX512.cpp must be compiled with AVX-512F enabled");
+
+const CinderKernels& kernels_avx512::getKernelTable()
+{
+    static constexpr CinderKernels table = makeKernelTable(SimdLevel::avx512);
+    return table;
+}
@@ -0,0 +1,9 @@
+// Baseline instruction set: SSE2 on x86-64, scalar elsewhere
+#define CINDER_KERNEL_NAMESPACE kernels_generic
+#include "KernelsImpl.h"
+
+const CinderKernels& kernels_generic::getKernelTable()
+{
+    static constexpr CinderKernels table = makeKernelTable(SimdLevel::generic);
+    return table;
+}
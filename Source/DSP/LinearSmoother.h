@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cmath>
+
+/**
+ * LinearSmoother - Linear parameter ramp (same stepping as juce::SmoothedValue)
+ *
+ * A new target restarts a ramp of a fixed number of samples from the current
+ * value, so the DSP core smooths exactly like the plugin did without JUCE.
+ */
+class LinearSmoother
+{
+public:
+    void reset(double sampleRate, double rampLengthSeconds)
+    {
+        stepsToTarget = static_cast<int>(std::floor(rampLengthSeconds * sampleRate));
+        setCurrentAndTargetValue(target);
+    }
+
+    void setCurrentAndTargetValue(float newValue)
+    {
+        target = current = newValue;
+        countdown = 0;
+    }
+
+    void setTargetValue(float newValue)
+    {
+        if (newValue == target)
+            return;
+
+        if (stepsToTarget <= 0)
+        {
+            setCurrentAndTargetValue(newValue);
+            return;
+        }
+
+        target = newValue;
+        countdown = stepsToTarget;
+        step = (target - current) / static_cast<float>(countdown);
+    }
+
+    float getNextValue()
+    {
+        if (countdown <= 0)
+            return target;
+
+        --countdown;
+        current = (countdown > 0) ? current + step : target;
+        return current;
+    }
+
+    bool isSmoothing() const { return countdown > 0; }
+    float getCurrentValue() const { return current; }
+    float getTargetValue() const { return target; }
+
+private:
+    float current = 0.0f;
+    float target = 0.0f;
+    float step = 0.0f;
+    int countdown = 0;
+    int stepsToTarget = 0;
+};
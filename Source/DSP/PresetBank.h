@@ -0,0 +1,135 @@
+#pragma once
+
+#include "CinderState.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+/**
+ * PresetBank - Read-only view of a binary preset bank
+ *
+ *   bytes 0-3    magic "CNDB"
+ *   bytes 4-5    format version (little-endian)
+ *   bytes 6-7    number of presets
+ *   bytes 8-9    values per preset
+ *   bytes 10-11  reserved (0)
+ *   then, per preset, a 32-byte NUL-padded UTF-8 name and the values as
+ *   little-endian float32 in CinderState's slot order (BasicCinderEngine::Param)
+ *
+ * Fixed-size records, so a preset is found by arithmetic and read straight
+ * out of the bank's memory, which can be a memory-mapped file or an image
+ * built at compile time (makeImage). Reading never allocates and is safe on
+ * the audio thread; the memory must outlive the view.
+ */
+class PresetBank
+{
+public:
+    static constexpr std::uint8_t magic[4] = { 'C', 'N', 'D', 'B' };
+    static constexpr std::uint16_t version = 1;
+    static constexpr size_t headerSize = 12;
+    static constexpr int nameSize = 32;
+
+    struct Preset
+    {
+        const char* name;
+        const float* values;
+    };
+
+    static constexpr size_t getSize(int numPresets, int numValues)
+    {
+        return headerSize + static_cast<size_t>(numPresets) * getRecordSize(numValues);
+    }
+
+    // Builds a bank image at compile time: constexpr auto image = PresetBank::makeImage<n, v>(presets)
+    template <int numPresets, int numValues>
+    static constexpr std::array<std::uint8_t, getSize(numPresets, numValues)> makeImage(const Preset (&presets)[numPresets])
+    {
+        std::array<std::uint8_t, getSize(numPresets, numValues)> image {};
+        for (size_t i = 0; i < 4; ++i)
+            image[i] = magic[i];
+        writeUint16(&image[4], version);
+        writeUint16(&image[6], static_cast<std::uint16_t>(numPresets));
+        writeUint16(&image[8], static_cast<std::uint16_t>(numValues));
+
+        for (int p = 0; p < numPresets; ++p)
+        {
+            std::uint8_t* record = &image[headerSize + static_cast<size_t>(p) * getRecordSize(numValues)];
+            for (int c = 0; c < nameSize - 1 && presets[p].name[c] != '\0'; ++c)
+                record[c] = static_cast<std::uint8_t>(presets[p].name[c]);
+            for (int v = 0; v < numValues; ++v)
+                CinderState::writeFloat(record + nameSize + 4 * v, presets[p].values[v]);
+        }
+        return image;
+    }
+
+    // Points the view at a bank. Returns false (and leaves the view empty) if
+    // the data is not a bank of this version or is truncated.
+    bool open(const void* bankData, size_t bankSize)
+    {
+        *this = {};
+        const auto* bytes = static_cast<const std::uint8_t*>(bankData);
+        if (bytes == nullptr || bankSize < headerSize || std::memcmp(bytes, magic, sizeof(magic)) != 0
+            || readUint16(bytes + 4) != version)
+            return false;
+
+        const int presets = readUint16(bytes + 6);
+        const int values = readUint16(bytes + 8);
+        if (bankSize < getSize(presets, values))
+            return false;
+
+        data = bytes;
+        numPresets = presets;
+        numValues = values;
+        return true;
+    }
+
+    int getNumPresets() const { return numPresets; }
+    int getNumValues() const { return numValues; }
+
+    std::string_view getName(int index) const
+    {
+        if (index < 0 || index >= numPresets)
+            return {};
+
+        const auto* name = reinterpret_cast<const char*>(getRecord(index));
+        size_t length = 0;
+        while (length < static_cast<size_t>(nameSize) && name[length] != '\0')
+            ++length;
+        return { name, length };
+    }
+
+    // Reads up to maxValues values of one preset; returns how many (0 for a bad index)
+    int readValues(int index, float* values, int maxValues) const
+    {
+        if (index < 0 || index >= numPresets)
+            return 0;
+
+        const std::uint8_t* in = getRecord(index) + nameSize;
+        const int count = numValues < maxValues ? numValues : maxValues;
+        for (int i = 0; i < count; ++i, in += 4)
+            values[i] = CinderState::readFloat(in);
+        return count;
+    }
+
+private:
+    const std::uint8_t* data = nullptr;
+    int numPresets = 0;
+    int numValues = 0;
+
+    static constexpr size_t getRecordSize(int values) { return static_cast<size_t>(nameSize) + 4 * static_cast<size_t>(values); }
+
+    const std::uint8_t* getRecord(int index) const
+    {
+        return data + headerSize + static_cast<size_t>(index) * getRecordSize(numValues);
+    }
+
+    static constexpr void writeUint16(std::uint8_t* bytes, std::uint16_t value)
+    {
+        bytes[0] = static_cast<std::uint8_t>(value & 0xff);
+        bytes[1] = static_cast<std::uint8_t>(value >> 8);
+    }
+
+    static constexpr int readUint16(const std::uint8_t* bytes) { return bytes[0] | (bytes[1] << 8); }
+};
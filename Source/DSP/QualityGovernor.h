@@ -0,0 +1,89 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+
+/**
+ * QualityGovernor - Picks a quality level from how long each block takes to process
+ *
+ * Fed every block's processing time and its real-time deadline (the block's
+ * length in seconds). The load (time / deadline) is averaged over ~300 ms,
+ * so a single slow block (a page fault, a preset change) moves nothing.
+ * Once the average has stayed above the step-down load for holdDownSeconds,
+ * the level drops by one (higher = cheaper); once it has stayed below the
+ * step-up load for holdUpSeconds, it climbs back by one. The step-up load is
+ * stepUpRatio of the step-down one, below half, so going back up a level,
+ * which at most doubles the cost, can't trigger the next step down by
+ * itself. Every change restarts both holds.
+ *
+ * The step-down load is per instance: this plugin's own share of the
+ * deadline, not the host's. The default, 30%, is about ten times a Cinder
+ * instance's usual cost (~3% of a 48 kHz deadline), so it is only reached
+ * when the machine is far slower than expected (throttled, oversubscribed),
+ * where the host is close to dropping out anyway. A lower value sheds
+ * quality earlier on machines that would have coped; owners pass their own
+ * (CinderConfig).
+ *
+ * No allocation, no locks: call update() on the audio thread and read the
+ * results anywhere through the owner's atomics.
+ */
+class QualityGovernor
+{
+public:
+    static constexpr float defaultStepDownLoad = 0.3f;
+    static constexpr float stepUpRatio = 0.4f;
+    static constexpr double holdDownSeconds = 0.5;
+    static constexpr double holdUpSeconds = 5.0;
+    static constexpr double averagingSeconds = 0.3;
+
+    explicit QualityGovernor(int numberOfLevels, float stepDownAt = defaultStepDownLoad)
+        : numLevels(std::max(1, numberOfLevels)),
+          stepDownLoad(std::max(stepDownAt, 0.01f)),
+          stepUpLoad(stepDownLoad * stepUpRatio)
+    {
+    }
+
+    // Back to full quality with no load history (e.g. after an offline render)
+    void reset()
+    {
+        level = 0;
+        averageLoad = 0.0f;
+        overTime = underTime = 0.0;
+    }
+
+    // One block: processing time and deadline in seconds. Returns the level to run at.
+    int update(double elapsedSeconds, double blockSeconds)
+    {
+        if (blockSeconds <= 0.0)
+            return level;
+
+        const float load = static_cast<float>(elapsedSeconds / blockSeconds);
+        const auto smoothing = static_cast<float>(1.0 - std::exp(-blockSeconds / averagingSeconds));
+        averageLoad += smoothing * (load - averageLoad);
+
+        overTime = averageLoad > stepDownLoad ? overTime + blockSeconds : 0.0;
+        underTime = averageLoad < stepUpLoad ? underTime + blockSeconds : 0.0;
+
+        if (overTime >= holdDownSeconds && level < numLevels - 1)
+        {
+            ++level;
+            overTime = underTime = 0.0;
+        }
+        else if (underTime >= holdUpSeconds && level > 0)
+        {
+            --level;
+            overTime = underTime = 0.0;
+        }
+        return level;
+    }
+
+    int getLevel() const { return level; }
+    float getLoad() const { return averageLoad; }   // averaged fraction of the deadline
+
+private:
+    int numLevels;
+    float stepDownLoad, stepUpLoad;
+    int level = 0;
+    float averageLoad = 0.0f;
+    double overTime = 0.0, underTime = 0.0;
+};
@@ -0,0 +1,218 @@
+#pragma once
+
+#include "ShimmerReverb.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+
+// Frozen copy of the per-sample CinderEngine (drive, freeze gate, reverbs,
+// duck, mix and scalar metering) from before the block/SIMD rewrite. Only
+// CinderVerify uses it; do not edit.
+namespace reference
+{
+
+class CinderEngine
+{
+public:
+    enum Param
+    {
+        drive = 0,
+        decay,
+        shimmer,
+        burn,
+        size,
+        duck,
+        mix,
+        freeze,
+        numParams
+    };
+
+    struct ParamRange
+    {
+        float minValue, maxValue, defaultValue;
+    };
+
+    // Must match CinderProcessor::createParameterLayout
+    static constexpr std::array<ParamRange, numParams> paramRanges {{
+        { 0.0f,  1.0f, 0.0f },   // drive
+        { 0.1f, 30.0f, 2.0f },   // decay (seconds, > 29.5 = infinite)
+        { 0.0f,  1.0f, 0.0f },   // shimmer
+        { 0.0f,  1.0f, 0.0f },   // burn
+        { 0.0f,  1.0f, 0.5f },   // size
+        { 0.0f,  1.0f, 0.0f },   // duck
+        { 0.0f,  1.0f, 0.3f },   // mix
+        { 0.0f,  1.0f, 0.0f },   // freeze (>= 0.5 = on)
+    }};
+
+    struct Meters
+    {
+        float reverbPeak = 0.0f;   // peak |wet L| (visualiser)
+        float outputRms = 0.0f;    // RMS of the mono output
+        float outputPeak = 0.0f;   // peak of the mono output
+    };
+
+    CinderEngine()
+    {
+        for (int i = 0; i < numParams; ++i)
+            targets[static_cast<size_t>(i)].store(paramRanges[static_cast<size_t>(i)].defaultValue);
+    }
+
+    void prepare(double sampleRate, int maxBlockSize)
+    {
+        shimmerReverbL.prepare(sampleRate, maxBlockSize);
+        shimmerReverbR.prepare(sampleRate, maxBlockSize);
+
+        // 50ms smoothing time
+        const double smoothingTime = 0.05;
+        for (auto& smoother : smoothers)
+            smoother.reset(sampleRate, smoothingTime);
+
+        for (int i = 0; i < numParams; ++i)
+            smoothers[static_cast<size_t>(i)].setCurrentAndTargetValue(getTarget(i));
+        smoothers[freeze].setCurrentAndTargetValue(0.0f);
+
+        // Envelope follower coefficients
+        envAttackCoeff = std::exp(-1.0f / (0.0005f * static_cast<float>(sampleRate)));   // 0.5ms attack
+        envReleaseCoeff = std::exp(-1.0f / (0.15f * static_cast<float>(sampleRate)));    // 150ms release
+        envState = 0.0f;
+    }
+
+    // Clears tails and jumps the smoothers to the current targets
+    void reset()
+    {
+        shimmerReverbL.reset();
+        shimmerReverbR.reset();
+        envState = 0.0f;
+
+        for (int i = 0; i < numParams; ++i)
+            smoothers[static_cast<size_t>(i)].setCurrentAndTargetValue(getTarget(i));
+    }
+
+    // Safe from any thread; takes effect at the next process() call
+    void setParameter(int index, float value)
+    {
+        if (index < 0 || index >= numParams)
+            return;
+
+        const auto& range = paramRanges[static_cast<size_t>(index)];
+        targets[static_cast<size_t>(index)].store(std::clamp(value, range.minValue, range.maxValue),
+                                                  std::memory_order_relaxed);
+    }
+
+    float getParameter(int index) const
+    {
+        return (index >= 0 && index < numParams) ? targets[static_cast<size_t>(index)].load(std::memory_order_relaxed)
+                                                 : 0.0f;
+    }
+
+    // In-place stereo processing. `left` and `right` may alias (mono).
+    Meters process(float* left, float* right, int numSamples)
+    {
+        for (int i = 0; i < numParams; ++i)
+            smoothers[static_cast<size_t>(i)].setTargetValue(getTarget(i));
+
+        float peakLevel = 0.0f;
+        float sumSquares = 0.0f;
+        float blockPeak = 0.0f;
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            // Get smoothed parameter values
+            const float drv = smoothers[drive].getNextValue();
+            const float dcy = smoothers[decay].getNextValue();
+            const float shm = smoothers[shimmer].getNextValue();
+            const float brn = smoothers[burn].getNextValue();
+            const float sz = smoothers[size].getNextValue();
+            const float dck = smoothers[duck].getNextValue();
+            const float mx = smoothers[mix].getNextValue();
+            const float fz = smoothers[freeze].getNextValue();
+
+            // Check for infinite mode (decay > 29.5s treated as freeze)
+            const bool infiniteMode = dcy > 29.5f;
+            const float baseDecay = infiniteMode ? 100.0f : dcy;
+            // When frozen, lerp decay toward infinite (100.0)
+            const float actualDecay = baseDecay + fz * (100.0f - baseDecay);
+
+            // 1. Save pristine dry input
+            const float dryL = left[i];
+            const float dryR = right[i];
+
+            // 2. Envelope follower on dry signal (for sidechain ducking)
+            const float dryMono = (std::abs(dryL) + std::abs(dryR)) * 0.5f;
+            const float envCoeff = (dryMono > envState) ? envAttackCoeff : envReleaseCoeff;
+            envState = envCoeff * envState + (1.0f - envCoeff) * dryMono;
+
+            // 3. Apply DRIVE saturation (warm input distortion)
+            //    driveGain: 1x (clean) to 6x (heavy saturation)
+            float driveGain = 1.0f + drv * 5.0f;
+            float drivenL = std::tanh(dryL * driveGain);
+            float drivenR = std::tanh(dryR * driveGain);
+
+            // 3b. Gate input when frozen (smoothed to avoid clicks)
+            drivenL *= (1.0f - fz);
+            drivenR *= (1.0f - fz);
+
+            // 4. Update reverb parameters (burn is applied inside the feedback loop)
+            shimmerReverbL.setParameters(actualDecay, shm, sz, brn);
+            shimmerReverbR.setParameters(actualDecay, shm, sz, brn);
+
+            // 5. Process shimmer reverb
+            float wetL = shimmerReverbL.process(drivenL);
+            float wetR = shimmerReverbR.process(drivenR);
+
+            // 6. Apply sidechain ducking
+            //    envState is raw amplitude (0-1 range for typical signals).
+            //    Scale by 5x so a signal peaking at ~0.5 drives full ducking.
+            if (dck > 0.001f)
+            {
+                float envScaled = std::min(envState * 5.0f, 1.0f);
+                float duckGain = std::max(0.0f, 1.0f - dck * envScaled);
+                wetL *= duckGain;
+                wetR *= duckGain;
+            }
+
+            // 7. Final dry/wet mix
+            left[i] = dryL * (1.0f - mx) + wetL * mx;
+            right[i] = dryR * (1.0f - mx) + wetR * mx;
+
+            // Track peak for visualization
+            peakLevel = std::max(peakLevel, std::abs(wetL));
+
+            // Accumulate for output metering
+            float outSample = (left[i] + right[i]) * 0.5f;
+            sumSquares += outSample * outSample;
+            blockPeak = std::max(blockPeak, std::abs(outSample));
+        }
+
+        Meters meters;
+        meters.reverbPeak = peakLevel;
+        if (numSamples > 0)
+        {
+            meters.outputRms = std::sqrt(sumSquares / static_cast<float>(numSamples));
+            meters.outputPeak = blockPeak;
+        }
+        return meters;
+    }
+
+private:
+    // DSP components
+    ShimmerReverb shimmerReverbL, shimmerReverbR;
+
+    // Parameter targets (any thread) and their smoothed values (audio thread)
+    std::array<std::atomic<float>, numParams> targets;
+    std::array<LinearSmoother, numParams> smoothers;
+
+    // Envelope follower state (for sidechain ducking)
+    float envState = 0.0f;
+    float envAttackCoeff = 0.0f;   // ~0.5ms attack
+    float envReleaseCoeff = 0.0f;  // ~150ms release
+
+    float getTarget(int index) const
+    {
+        const float value = targets[static_cast<size_t>(index)].load(std::memory_order_relaxed);
+        return index == freeze ? (value >= 0.5f ? 1.0f : 0.0f) : value;
+    }
+};
+
+} // namespace reference
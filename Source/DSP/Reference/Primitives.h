@@ -0,0 +1,137 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+/**
+ * Reference primitives - Frozen copies of DelayBuffer and LinearSmoother
+ *
+ * The reference kernels in this directory use these instead of the live
+ * headers, so optimising a primitive never changes the reference it is
+ * checked against. Do not edit.
+ */
+namespace reference
+{
+
+/**
+ * DelayBuffer - Single-channel fractional delay line (linear interpolation)
+ *
+ * Drop-in for the juce::dsp::DelayLine<float, Linear> calls the reverb used,
+ * so the DSP headers build without JUCE:
+ * - popSample(d) reads the sample pushed d samples ago (clamped to the maximum)
+ * - pushSample(x) writes the next sample
+ *
+ * Storage is a power-of-two ring, so wrapping is a mask instead of a modulo.
+ * All memory is allocated in prepare(); pop/push never allocate.
+ */
+class DelayBuffer
+{
+public:
+    DelayBuffer() = default;
+
+    void prepare(int maxDelayInSamples)
+    {
+        maxDelay = std::max(0, maxDelayInSamples);
+
+        // +2: one slot for the sample being written, one for the interpolation partner
+        int size = 4;
+        while (size < maxDelay + 2)
+            size <<= 1;
+
+        buffer.assign(static_cast<size_t>(size), 0.0f);
+        mask = size - 1;
+        writePos = 0;
+    }
+
+    void reset()
+    {
+        std::fill(buffer.begin(), buffer.end(), 0.0f);
+        writePos = 0;
+    }
+
+    int getMaximumDelayInSamples() const { return maxDelay; }
+
+    float popSample(float delayInSamples) const
+    {
+        const float delay = std::clamp(delayInSamples, 0.0f, static_cast<float>(maxDelay));
+        const int delayInt = static_cast<int>(delay);
+        const float delayFrac = delay - static_cast<float>(delayInt);
+
+        const float value1 = buffer[static_cast<size_t>((writePos - delayInt) & mask)];
+        const float value2 = buffer[static_cast<size_t>((writePos - delayInt - 1) & mask)];
+        return value1 + delayFrac * (value2 - value1);
+    }
+
+    void pushSample(float sample)
+    {
+        buffer[static_cast<size_t>(writePos)] = sample;
+        writePos = (writePos + 1) & mask;
+    }
+
+private:
+    std::vector<float> buffer = std::vector<float>(4, 0.0f);
+    int mask = 3;
+    int writePos = 0;
+    int maxDelay = 0;
+};
+
+/**
+ * LinearSmoother - Linear parameter ramp (same stepping as juce::SmoothedValue)
+ *
+ * A new target restarts a ramp of a fixed number of samples from the current
+ * value, so the DSP core smooths exactly like the plugin did without JUCE.
+ */
+class LinearSmoother
+{
+public:
+    void reset(double sampleRate, double rampLengthSeconds)
+    {
+        stepsToTarget = static_cast<int>(std::floor(rampLengthSeconds * sampleRate));
+        setCurrentAndTargetValue(target);
+    }
+
+    void setCurrentAndTargetValue(float newValue)
+    {
+        target = current = newValue;
+        countdown = 0;
+    }
+
+    void setTargetValue(float newValue)
+    {
+        if (newValue == target)
+            return;
+
+        if (stepsToTarget <= 0)
+        {
+            setCurrentAndTargetValue(newValue);
+            return;
+        }
+
+        target = newValue;
+        countdown = stepsToTarget;
+        step = (target - current) / static_cast<float>(countdown);
+    }
+
+    float getNextValue()
+    {
+        if (countdown <= 0)
+            return target;
+
+        --countdown;
+        current = (countdown > 0) ? current + step : target;
+        return current;
+    }
+
+    bool isSmoothing() const { return countdown > 0; }
+    float getTargetValue() const { return target; }
+
+private:
+    float current = 0.0f;
+    float target = 0.0f;
+    float step = 0.0f;
+    int countdown = 0;
+    int stepsToTarget = 0;
+};
+
+} // namespace reference
@@ -0,0 +1,310 @@
+#pragma once
+
+#include "Primitives.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
+
+// Frozen copy of the scalar ShimmerReverb (8-line shimmer FDN) from before
+// any SIMD or approximation work. Only CinderVerify uses it; do not edit.
+namespace reference
+{
+
+/**
+ * ShimmerReverb - 8-channel Feedback Delay Network with pitch-shifted feedback
+ * 
+ * Architecture:
+ * - Input diffusion (4 allpass filters to smear transients)
+ * - 8 parallel delay lines with prime-ish lengths
+ * - Hadamard matrix mixing for energy-preserving feedback
+ * - Pitch shifter in feedback loop for shimmer effect
+ * - Damping filters for natural high-frequency decay
+ */
+class ShimmerReverb
+{
+public:
+    ShimmerReverb() = default;
+
+    void prepare(double sr, int /*maxBlockSize*/)
+    {
+        sampleRate = sr;
+
+        // Calculate delay times based on sample rate
+        // Using prime-ish numbers for inharmonic density
+        const std::array<float, 8> baseDelayMs = {35.3f, 36.7f, 33.8f, 32.3f, 29.0f, 30.8f, 27.0f, 25.3f};
+        
+        for (int i = 0; i < 8; ++i)
+        {
+            int delaySamples = static_cast<int>(baseDelayMs[i] * sampleRate / 1000.0f);
+            delayLines[i].prepare(delaySamples * 4); // Extra headroom for size modulation
+            baseDelayTimes[i] = delaySamples;
+        }
+
+        // Input diffusers (allpass chain)
+        for (int i = 0; i < 4; ++i)
+            inputDiffusers[i].prepare(static_cast<int>(sampleRate * 0.05)); // 50ms max
+
+        // Damping filters (one-pole lowpass per delay line)
+        for (auto& filter : dampingFilters)
+        {
+            filter = 0.0f;
+        }
+
+        // Pitch shifter for shimmer (dual-grain overlap-add)
+        pitchShiftBuffer.resize(static_cast<size_t>(sampleRate * 0.5)); // 500ms buffer
+        std::fill(pitchShiftBuffer.begin(), pitchShiftBuffer.end(), 0.0f);
+        pitchShiftWritePos = 0;
+        grainReadPos[0] = 0.0f;
+        grainReadPos[1] = 0.0f;
+        grainPhase[0] = 0;
+        grainPhase[1] = grainSize / 2;  // Second grain starts 50% offset
+
+        reset();
+    }
+
+    void reset()
+    {
+        for (auto& dl : delayLines)
+            dl.reset();
+        for (auto& diff : inputDiffusers)
+            diff.reset();
+        for (auto& state : delayLineStates)
+            state = 0.0f;
+        std::fill(pitchShiftBuffer.begin(), pitchShiftBuffer.end(), 0.0f);
+        pitchShiftWritePos = 0;
+        grainReadPos[0] = 0.0f;
+        grainReadPos[1] = 0.0f;
+        grainPhase[0] = 0;
+        grainPhase[1] = grainSize / 2;
+    }
+
+    void setParameters(float decaySeconds, float shimmerAmount, float size, float burn)
+    {
+        // Convert decay time to feedback gain
+        // Using RT60 formula: gain = 10^(-3 * delayTime / RT60)
+        // Cap feedback well below unity to prevent runaway
+        if (decaySeconds > 50.0f)
+        {
+            // "Infinite" mode - still slightly below unity for stability
+            feedbackGain = 0.9985f;
+        }
+        else
+        {
+            // Average delay time ~30ms
+            const float avgDelaySeconds = 0.030f;
+            feedbackGain = std::pow(10.0f, -3.0f * avgDelaySeconds / decaySeconds);
+            // Cap at 0.998 — allows long, lush tails without runaway
+            feedbackGain = std::clamp(feedbackGain, 0.0f, 0.998f);
+        }
+
+        shimmerMix = shimmerAmount;
+        roomSize = std::clamp(size, 0.0f, 1.0f);
+
+        // Damping: higher roomSize = less damping (brighter)
+        // Also reduce damping coefficient to absorb more energy
+        dampingCoeff = 0.2f + roomSize * 0.4f;
+
+        // Compensate feedback for shimmer energy injection
+        // Shimmer adds energy, so reduce feedback proportionally
+        shimmerCompensation = 1.0f - (shimmerAmount * 0.08f);
+
+        burnAmount = std::clamp(burn, 0.0f, 1.0f);
+    }
+
+    float process(float input)
+    {
+        // 1. Input diffusion (smears transients for smoother reverb)
+        float diffused = input;
+        const std::array<float, 4> diffuserDelays = {0.0042f, 0.0036f, 0.0029f, 0.0023f}; // seconds
+        const float diffuserGain = 0.6f;
+
+        for (int i = 0; i < 4; ++i)
+        {
+            float delaySamples = static_cast<float>(diffuserDelays[i] * sampleRate);
+            float delayed = inputDiffusers[i].popSample(delaySamples);
+            float toWrite = diffused + delayed * diffuserGain;
+            inputDiffusers[i].pushSample(toWrite);
+            diffused = delayed - diffused * diffuserGain;
+        }
+
+        // 2. Read from delay lines and apply Hadamard mixing
+        std::array<float, 8> delayOutputs;
+        for (int i = 0; i < 8; ++i)
+        {
+            // Modulate delay time by room size
+            float delayTime = baseDelayTimes[i] * (0.5f + roomSize);
+            delayOutputs[i] = delayLines[i].popSample(delayTime);
+        }
+
+        // 3. Hadamard matrix mixing (8x8, normalized)
+        // This creates dense, energy-preserving feedback
+        std::array<float, 8> mixed = hadamardMix(delayOutputs);
+
+        // 4. Apply damping (one-pole lowpass), burn saturation, soft limiting, and feedback gain
+        for (int i = 0; i < 8; ++i)
+        {
+            // Simple one-pole lowpass for damping
+            dampingFilters[i] = dampingFilters[i] + dampingCoeff * (mixed[i] - dampingFilters[i]);
+
+            // BURN: drive into soft limiter for progressive saturation per echo
+            // At burn=0: gain=1x (clean, no extra saturation)
+            // At burn=1: gain=5x (heavy drive into tanh limiter)
+            float burnGain = 1.0f + burnAmount * 4.0f;
+            float burned = dampingFilters[i] * burnGain;
+            float limited = softLimit(burned);
+
+            // Apply feedback gain with shimmer compensation
+            mixed[i] = limited * feedbackGain * shimmerCompensation;
+        }
+
+        // 5. Apply shimmer (pitch shift) in feedback
+        // Mix all 8 FDN channels into the pitch shifter for full-spectrum shimmer
+        float shimmerInput = 0.0f;
+        for (int i = 0; i < 8; ++i)
+            shimmerInput += mixed[i];
+        shimmerInput *= 0.125f; // normalize (1/8)
+        float pitchShifted = processPitchShift(shimmerInput);
+
+        // 6. Write to delay lines (input + feedback, with shimmer blended into all channels)
+        float inputContribution = diffused / 8.0f;
+        for (int i = 0; i < 8; ++i)
+        {
+            float shimmerContrib = pitchShifted * shimmerMix * 0.5f;
+            float toWrite = mixed[i] + inputContribution + shimmerContrib;
+            // Final safety limiter before writing to delay
+            delayLines[i].pushSample(softLimit(toWrite));
+        }
+
+        // 7. Output: sum all delay lines
+        float output = 0.0f;
+        for (int i = 0; i < 8; ++i)
+        {
+            output += delayOutputs[i];
+        }
+        return output * 0.25f; // Normalize output level
+    }
+
+private:
+    double sampleRate = 44100.0;
+    
+    // 8-channel FDN
+    std::array<DelayBuffer, 8> delayLines;
+    std::array<int, 8> baseDelayTimes;
+    std::array<float, 8> delayLineStates{};
+    
+    // Input diffusers
+    std::array<DelayBuffer, 4> inputDiffusers;
+    
+    // Damping filters (simple one-pole state)
+    std::array<float, 8> dampingFilters{};
+    float dampingCoeff = 0.7f;
+    
+    // Parameters
+    float feedbackGain = 0.85f;
+    float shimmerMix = 0.0f;
+    float roomSize = 0.5f;
+    float shimmerCompensation = 1.0f;
+    float burnAmount = 0.0f;
+
+    // Pitch shifter state (dual-grain overlap-add)
+    std::vector<float> pitchShiftBuffer;
+    int pitchShiftWritePos = 0;
+    float grainReadPos[2] = {0.0f, 0.0f};   // Two overlapping grains
+    int grainPhase[2] = {0, 0};               // Phase counter per grain
+    static constexpr int grainSize = 1024;     // Grain length in samples
+    static constexpr float pi = 3.14159265358979323846f;
+
+    // Soft limiter to prevent runaway - uses tanh for smooth limiting
+    float softLimit(float x)
+    {
+        // Threshold above which we start limiting
+        const float threshold = 0.8f;
+        
+        if (std::abs(x) < threshold)
+            return x;
+        
+        // Soft saturation above threshold using tanh
+        float sign = (x > 0.0f) ? 1.0f : -1.0f;
+        float excess = std::abs(x) - threshold;
+        float limited = threshold + (1.0f - threshold) * std::tanh(excess * 2.0f);
+        return sign * limited;
+    }
+
+    // Hadamard matrix multiplication (8x8)
+    std::array<float, 8> hadamardMix(const std::array<float, 8>& input)
+    {
+        // Normalized 8x8 Hadamard matrix
+        // Each row/column has entries of +1 or -1, normalized by 1/sqrt(8)
+        const float norm = 1.0f / std::sqrt(8.0f);
+        
+        std::array<float, 8> output;
+        
+        // Using the recursive Hadamard structure
+        // H8 = [[H4, H4], [H4, -H4]]
+        for (int i = 0; i < 8; ++i)
+        {
+            float sum = 0.0f;
+            for (int j = 0; j < 8; ++j)
+            {
+                // Hadamard entry: (-1)^(popcount(i & j))
+                int bits = i & j;
+                int popcount = 0;
+                while (bits) { popcount += bits & 1; bits >>= 1; }
+                float sign = (popcount % 2 == 0) ? 1.0f : -1.0f;
+                sum += sign * input[j];
+            }
+            output[i] = sum * norm;
+        }
+        
+        return output;
+    }
+
+    // Dual-grain overlap-add pitch shifter (+1 octave)
+    // Two grains with 50% overlap and Hann windowing for artifact-free output
+    float processPitchShift(float input)
+    {
+        const int bufSize = static_cast<int>(pitchShiftBuffer.size());
+        const float pitchRatio = 2.0f;
+
+        // Write to circular buffer
+        pitchShiftBuffer[pitchShiftWritePos] = input;
+        pitchShiftWritePos = (pitchShiftWritePos + 1) % bufSize;
+
+        float output = 0.0f;
+
+        for (int g = 0; g < 2; ++g)
+        {
+            // Advance read position at pitch ratio speed
+            grainReadPos[g] += pitchRatio;
+            if (grainReadPos[g] >= static_cast<float>(bufSize))
+                grainReadPos[g] -= static_cast<float>(bufSize);
+
+            // Hann window based on grain phase
+            float phase = static_cast<float>(grainPhase[g]) / static_cast<float>(grainSize);
+            float window = 0.5f - 0.5f * std::cos(2.0f * pi * phase);
+
+            // Linear interpolation read
+            int readIdx = static_cast<int>(grainReadPos[g]);
+            float frac = grainReadPos[g] - static_cast<float>(readIdx);
+            int nextIdx = (readIdx + 1) % bufSize;
+            float sample = pitchShiftBuffer[readIdx] * (1.0f - frac) +
+                           pitchShiftBuffer[nextIdx] * frac;
+
+            output += sample * window;
+
+            // Advance grain phase, reset grain when it completes
+            grainPhase[g]++;
+            if (grainPhase[g] >= grainSize)
+            {
+                grainPhase[g] = 0;
+                // Re-sync read position near write position to read fresh audio
+                grainReadPos[g] = static_cast<float>((pitchShiftWritePos - grainSize + bufSize) % bufSize);
+            }
+        }
+
+        return output;
+    }
+};
+
+} // namespace reference
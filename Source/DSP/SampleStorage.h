@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+/**
+ * SampleStorage - Sample formats for delay memory
+ *
+ *   float32  exact (default)
+ *   float16  IEEE half: 11-bit mantissa, so the error stays ~-66 dB below
+ *            the signal all the way down the tail
+ *   int16    fixed point, full scale +-1: a -96 dBFS noise floor the tail
+ *            decays into (a grittier, lo-fi ending)
+ *
+ * Both 16-bit formats halve the memory a delay line touches per sample. The
+ * loop's safety saturator keeps everything written to the lines within +-1, so
+ * int16 never clips in practice; larger values saturate.
+ *
+ * The scalar codecs below are for baseline code (DelayBuffer and the generic
+ * kernels); the AVX2 / AVX-512 kernels use the F16C instructions instead (see
+ * SimdFloat.h). Half conversion rounds to nearest even and only uses normal
+ * float arithmetic, so it is unaffected by flush-to-zero / denormals-are-zero.
+ * Infinities and NaN are not preserved (they encode as the largest half).
+ */
+enum class SampleStorage
+{
+    float32 = 0,
+    float16,
+    int16
+};
+
+namespace SampleCodec
+{
+inline std::uint32_t bitsOf(float x)
+{
+    std::uint32_t u;
+    std::memcpy(&u, &x, sizeof(u));
+    return u;
+}
+
+inline float floatOf(std::uint32_t u)
+{
+    float x;
+    std::memcpy(&x, &u, sizeof(x));
+    return x;
+}
+
+inline std::uint16_t floatToHalf(float x)
+{
+    constexpr std::uint32_t halfMax = 0x477fe000u;                             // 65504
+    constexpr std::uint32_t smallestNormal = 113u << 23;                       // 2^-14
+    constexpr std::uint32_t denormMagic = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+
+    std::uint32_t u = bitsOf(x);
+    const std::uint32_t sign = u & 0x80000000u;
+    u ^= sign;
+    if (! (u <= halfMax))   // also catches NaN bit patterns
+        u = halfMax;
+
+    std::uint32_t h;
+    if (u < smallestNormal)
+    {
+        // Half subnormal or zero: the float add lines the mantissa up and rounds it
+        h = bitsOf(floatOf(u) + floatOf(denormMagic)) - denormMagic;
+    }
+    else
+    {
+        // Rebias the exponent and round the mantissa to nearest even
+        const std::uint32_t mantissaOdd = (u >> 13) & 1u;
+        h = (u + ((15u - 127u) << 23) + 0xfffu + mantissaOdd) >> 13;
+    }
+    return static_cast<std::uint16_t>(h | (sign >> 16));
+}
+
+inline float halfToFloat(std::uint16_t h)
+{
+    constexpr std::uint32_t exponentMask = 0x7c00u << 13;
+    constexpr float denormMagic = 6.103515625e-05f;   // 2^-14
+
+    std::uint32_t u = (static_cast<std::uint32_t>(h) & 0x7fffu) << 13;
+    const std::uint32_t exponent = u & exponentMask;
+    u += (127u - 15u) << 23;
+
+    float x = floatOf(u);
+    if (exponent == 0)
+        x = floatOf(u + (1u << 23)) - denormMagic;   // subnormal or zero
+
+    return floatOf(bitsOf(x) | ((static_cast<std::uint32_t>(h) & 0x8000u) << 16));
+}
+
+inline std::int16_t floatToInt16(float x)
+{
+    const float scaled = x * 32767.0f;
+    const float clamped = scaled < 32767.0f ? (scaled > -32767.0f ? scaled : -32767.0f) : 32767.0f;   // NaN -> max
+    return static_cast<std::int16_t>(clamped + (clamped >= 0.0f ? 0.5f : -0.5f));
+}
+
+inline float int16ToFloat(std::int16_t x)
+{
+    return static_cast<float>(x) * (1.0f / 32767.0f);
+}
+} // namespace SampleCodec
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "SampleStorage.h"
+
+/**
+ * ShimmerBatchState - Plain-data state of a ShimmerReverbBatch
+ *
+ * Shared between ShimmerReverbBatch (which owns the memory and computes the
+ * coefficients) and the per-ISA batch kernels in Kernels/. Deliberately free
+ * of standard-library types: the kernels are compiled with different
+ * instruction sets, and must not instantiate inline library code that the
+ * linker could then share with baseline translation units.
+ *
+ * Lane k of every array belongs to instance k. Delay memory is
+ * [group][line][frame][width], where width is the SIMD width of the kernel
+ * chosen at prepare time and a group is `width` consecutive lanes.
+ *
+ * The FDN lines and pitch buffer hold samples in `storage` format (float,
+ * half or int16; see SampleStorage.h), so they are untyped here. Packed
+ * memory has one element of padding at the end for the 16-bit gathers. The
+ * diffusers are short enough to always stay float.
+ */
+struct ShimmerBatchState
+{
+    static constexpr int numLanes = 16;
+    static constexpr int numLines = 8;
+    static constexpr int numDiffusers = 4;
+    static constexpr int grainSize = 1024;
+
+    struct Coefficients
+    {
+        alignas(64) float loopGain[numLanes] {};      // feedbackGain * shimmerCompensation
+        alignas(64) float damping[numLanes] {};
+        alignas(64) float burnGain[numLanes] {};
+        alignas(64) float shimmerSend[numLanes] {};   // shimmerMix * 0.5
+        alignas(64) float delay[numLines][numLanes] {};
+    };
+
+    // Write positions and grain state, identical for every lane
+    struct Positions
+    {
+        int fdnWrite = 0;
+        int diffuserWrite = 0;
+        int pitchWrite = 0;
+        float grainReadPos[2] = {0.0f, 0.0f};
+        int grainPhase[2] = {0, 0};
+    };
+
+    // Ramp start and per-sample step for the current block
+    Coefficients current, step;
+    Positions positions;
+    alignas(64) float dampingFilters[numLines][numLanes] {};
+
+    int width = 1;   // SIMD width the memory is laid out for
+    SampleStorage storage = SampleStorage::float32;   // format of fdnMemory and pitchMemory
+
+    void* fdnMemory = nullptr;
+    int fdnFrames = 0;   // power of two
+
+    float* diffuserMemory = nullptr;
+    int diffuserFrames = 0;   // power of two
+    int diffuserDelayInt[numDiffusers] {};
+    float diffuserDelayFrac[numDiffusers] {};
+
+    void* pitchMemory = nullptr;
+    int pitchFrames = 0;
+    float grainWindow[grainSize] {};
+};
@@ -1,6 +1,9 @@
 #pragma once
 
-#include <juce_dsp/juce_dsp.h>
+#include "DelayBuffer.h"
+#include "SimdFloat.h"
+#include "VelvetDiffuser.h"
+#include <algorithm>
 #include <array>
 #include <cmath>
 
@@ -8,210 +11,928 @@
  * ShimmerReverb - 8-channel Feedback Delay Network with pitch-shifted feedback
  * 
  * Architecture:
- * - Input diffusion (4 allpass filters to smear transients)
- * - 8 parallel delay lines with prime-ish lengths
+ * - Input diffusion (4 allpass filters, or a velvet-noise FIR, to smear transients)
+ * - 8 parallel delay lines with prime-ish lengths (4 in BasicShimmerReverb<4>, for Cinder Lite)
  * - Hadamard matrix mixing for energy-preserving feedback
  * - Pitch shifter in feedback loop for shimmer effect
- * - Damping filters for natural high-frequency decay
+ * - Damping filters for natural high-frequency decay, plus low/high band decay shelves
+ * - DC blocker and energy governor on the loop (instead of per-sample limiting)
+ * - Optional LFO modulation of the line lengths
  */
-class ShimmerReverb
+template <int fdnOrder>
+class BasicShimmerReverb
 {
 public:
-    ShimmerReverb() = default;
+    static_assert(fdnOrder == 4 || fdnOrder == 8, "FDN order must be 4 or 8");
 
-    void prepare(double sr, int maxBlockSize)
+    enum class InputDiffusion
     {
-        sampleRate = sr;
+        allpass = 0,   // four serial allpasses (default)
+        velvet         // sparse velvet-noise FIR
+    };
 
-        // Calculate delay times based on sample rate
-        // Using prime-ish numbers for inharmonic density
-        const std::array<float, 8> baseDelayMs = {35.3f, 36.7f, 33.8f, 32.3f, 29.0f, 30.8f, 27.0f, 25.3f};
-        
-        for (int i = 0; i < 8; ++i)
-        {
-            int delaySamples = static_cast<int>(baseDelayMs[i] * sampleRate / 1000.0f);
-            delayLines[i].setMaximumDelayInSamples(delaySamples * 4); // Extra headroom for size modulation
-            delayLines[i].prepare({sampleRate, static_cast<juce::uint32>(maxBlockSize), 1});
-            baseDelayTimes[i] = delaySamples;
-        }
+    BasicShimmerReverb() = default;
 
-        // Input diffusers (allpass chain)
-        for (int i = 0; i < 4; ++i)
-        {
-            inputDiffusers[i].prepare({sampleRate, static_cast<juce::uint32>(maxBlockSize), 1});
-            inputDiffusers[i].setMaximumDelayInSamples(static_cast<int>(sampleRate * 0.05)); // 50ms max
-        }
+    // Sizes everything for the rate; construction allocates nothing. Preparing
+    // again with the rate and storage already in place does nothing (the
+    // tails ring on); a new storage format only reallocates the FDN lines and
+    // the pitch buffer.
+    void prepare(double sr, int /*maxBlockSize*/)
+    {
+        const bool rateChanged = sr != preparedRate;
+        if (! rateChanged && storage == preparedStorage)
+            return;
 
-        // Damping filters (one-pole lowpass per delay line)
-        for (auto& filter : dampingFilters)
-        {
-            filter = 0.0f;
-        }
+        sampleRate = sr;
+        if (rateChanged)
+            prepareForRate();
 
-        // Pitch shifter for shimmer (dual-grain overlap-add)
-        pitchShiftBuffer.resize(static_cast<size_t>(sampleRate * 0.5)); // 500ms buffer
-        std::fill(pitchShiftBuffer.begin(), pitchShiftBuffer.end(), 0.0f);
-        pitchShiftWritePos = 0;
-        grainReadPos[0] = 0.0f;
-        grainReadPos[1] = 0.0f;
-        grainPhase[0] = 0;
-        grainPhase[1] = grainSize / 2;  // Second grain starts 50% offset
+        // FDN lines (extra headroom for size modulation) and the pitch shifter's 500ms buffer
+        for (int i = 0; i < fdnOrder; ++i)
+            delayLines[i].prepare(baseDelayTimes[i] * 4, storage);
+        integerTapsValid = false;
+        pitchShiftBuffer.allocate(static_cast<int>(sampleRate * 0.5), storage);
 
+        preparedRate = sr;
+        preparedStorage = storage;
         reset();
     }
 
+    // Constant time: the delay memory is not cleared. The FDN lines, input
+    // diffusers and pitch buffer each count the samples written since, and
+    // read 0 from further back until the writes have come round, so the
+    // output is that of zeroed buffers (only the small velvet ring is cleared).
     void reset()
     {
         for (auto& dl : delayLines)
             dl.reset();
         for (auto& diff : inputDiffusers)
             diff.reset();
+        velvetDiffuser.reset();
         for (auto& state : delayLineStates)
             state = 0.0f;
-        std::fill(pitchShiftBuffer.begin(), pitchShiftBuffer.end(), 0.0f);
+        dampingFilters.fill(0.0f);
+        dcInputs.fill(0.0f);
+        dcOutputs.fill(0.0f);
+        bandDecay.clear();
+        modulationOffsets.fill(0.0f);
+        modulationTargets.fill(0.0f);
+        modulationSteps.fill(0.0f);
+        modulationActive = false;
+        modulationCountdown = 0;
+        governorGain = governorTarget = 1.0f;
+        governorStep = governorEnergy = 0.0f;
+        governorCountdown = governorInterval;
+        stateFinite = true;
         pitchShiftWritePos = 0;
+        pitchShiftWritten = 0;
         grainReadPos[0] = 0.0f;
         grainReadPos[1] = 0.0f;
         grainPhase[0] = 0;
         grainPhase[1] = grainSize / 2;
     }
 
-    void setParameters(float decaySeconds, float shimmerAmount, float size, float burn)
+    // Frees the delay memory (the settings are kept); prepare() again before processing
+    void release()
+    {
+        for (auto& dl : delayLines)
+            dl.release();
+        for (auto& diff : inputDiffusers)
+            diff.release();
+        velvetDiffuser.release();
+        pitchShiftBuffer.release();
+        integerTapsValid = false;
+        preparedRate = 0.0;
+    }
+
+    /**
+     * Coefficients - What setParameters() derives from DECAY / SHIMMER / SIZE / BURN
+     *
+     * computeCoefficients() does the maths (including the pow for the
+     * feedback gain) and is independent of the sample rate, so endpoint sets
+     * can be computed on any thread. Everything here is either linear in its
+     * parameter or a gain, so lerp() between two sets is a plain
+     * per-member blend: a morph costs one lerp per coefficient.
+     */
+    struct Coefficients
+    {
+        float feedbackGain = 0.85f;
+        float dampingCoeff = 0.4f;
+        float shimmerCompensation = 1.0f;
+        float shimmerMix = 0.0f;
+        float burnAmount = 0.0f;    // BURN drive is 1 + 4 x this
+        float roomSize = 0.5f;      // line lengths scale by 0.5 + this
+        float decayTime = 2.0f;     // seconds; band decay shelves only (control rate)
+
+        static Coefficients lerp(const Coefficients& a, const Coefficients& b, float t)
+        {
+            return { a.feedbackGain + t * (b.feedbackGain - a.feedbackGain),
+                     a.dampingCoeff + t * (b.dampingCoeff - a.dampingCoeff),
+                     a.shimmerCompensation + t * (b.shimmerCompensation - a.shimmerCompensation),
+                     a.shimmerMix + t * (b.shimmerMix - a.shimmerMix),
+                     a.burnAmount + t * (b.burnAmount - a.burnAmount),
+                     a.roomSize + t * (b.roomSize - a.roomSize),
+                     a.decayTime + t * (b.decayTime - a.decayTime) };
+        }
+    };
+
+    // Loop gain for decays past 50s (and FREEZE): just below unity
+    static constexpr float infiniteFeedbackGain = 0.9985f;
+
+    static Coefficients computeCoefficients(float decaySeconds, float shimmerAmount, float size, float burn)
     {
+        Coefficients c;
+        c.decayTime = decaySeconds;
+
         // Convert decay time to feedback gain
         // Using RT60 formula: gain = 10^(-3 * delayTime / RT60)
         // Cap feedback well below unity to prevent runaway
         if (decaySeconds > 50.0f)
         {
             // "Infinite" mode - still slightly below unity for stability
-            feedbackGain = 0.9985f;
+            c.feedbackGain = infiniteFeedbackGain;
         }
         else
         {
             // Average delay time ~30ms
             const float avgDelaySeconds = 0.030f;
-            feedbackGain = std::pow(10.0f, -3.0f * avgDelaySeconds / decaySeconds);
+            c.feedbackGain = std::pow(10.0f, -3.0f * avgDelaySeconds / decaySeconds);
             // Cap at 0.998 — allows long, lush tails without runaway
-            feedbackGain = std::clamp(feedbackGain, 0.0f, 0.998f);
+            c.feedbackGain = std::clamp(c.feedbackGain, 0.0f, 0.998f);
         }
 
-        shimmerMix = shimmerAmount;
-        roomSize = std::clamp(size, 0.0f, 1.0f);
+        c.shimmerMix = shimmerAmount;
+        c.roomSize = std::clamp(size, 0.0f, 1.0f);
 
         // Damping: higher roomSize = less damping (brighter)
         // Also reduce damping coefficient to absorb more energy
-        dampingCoeff = 0.2f + roomSize * 0.4f;
+        c.dampingCoeff = 0.2f + c.roomSize * 0.4f;
 
         // Compensate feedback for shimmer energy injection
         // Shimmer adds energy, so reduce feedback proportionally
-        shimmerCompensation = 1.0f - (shimmerAmount * 0.08f);
+        c.shimmerCompensation = 1.0f - (shimmerAmount * 0.08f);
+
+        c.burnAmount = std::clamp(burn, 0.0f, 1.0f);
+        return c;
+    }
+
+    // computeCoefficients() then setCoefficients(). Callers morphing between fixed
+    // settings compute the endpoint sets once and pass per-sample blends
+    // (Coefficients::lerp) to processBlock() instead.
+    void setParameters(float decaySeconds, float shimmerAmount, float size, float burn)
+    {
+        setCoefficients(computeCoefficients(decaySeconds, shimmerAmount, size, burn));
+    }
+
+    // As setParameters(), from precomputed (or morphed) coefficients: no maths
+    void setCoefficients(const Coefficients& c)
+    {
+        if (c.decayTime != decayTime)
+        {
+            decayTime = c.decayTime;
+            bandDecayDirty = true;
+        }
+
+        if (c.roomSize != roomSize)
+        {
+            roomSize = c.roomSize;
+            integerTapsValid = false;
+            bandDecayDirty = true;
+            sizeChanged = true;
+        }
+
+        feedbackGain = c.feedbackGain;
+        dampingCoeff = c.dampingCoeff;
+        shimmerCompensation = c.shimmerCompensation;
+        shimmerMix = c.shimmerMix;
+        burnAmount = c.burnAmount;
+    }
 
-        burnAmount = std::clamp(burn, 0.0f, 1.0f);
+    // Low (< 250 Hz) / high (> 4 kHz) RT60 as multiples of DECAY (0.25..4,
+    // 1 = flat), through a low and a high shelf per line (see updateBandDecay).
+    // Cheap to call every sample; filters follow at control rate.
+    void setBandDecay(float lowMultiplier, float highMultiplier)
+    {
+        lowMultiplier = std::clamp(lowMultiplier, 0.25f, 4.0f);
+        highMultiplier = std::clamp(highMultiplier, 0.25f, 4.0f);
+        if (lowMultiplier != lowDecayMultiplier || highMultiplier != highDecayMultiplier)
+        {
+            lowDecayMultiplier = lowMultiplier;
+            highDecayMultiplier = highMultiplier;
+            bandDecayDirty = true;
+        }
     }
 
+    // LFO depth on the FDN line lengths (0..1 = 0..+-0.5 ms, 0 = static).
+    // Each line sweeps with its own slow sine, which breaks up the metallic
+    // ringing of static lengths in long tails (see readModulated).
+    void setModulation(float depth)
+    {
+        modulationDepth = std::clamp(depth, 0.0f, 1.0f);
+    }
+
+    // Allpass chain or velvet-noise diffuser (a sparse FIR: no feedback, no
+    // fractional reads, fewer operations); audio thread, or before processing starts
+    void setInputDiffusion(InputDiffusion newDiffusion) { inputDiffusion = newDiffusion; }
+    InputDiffusion getInputDiffusion() const { return inputDiffusion; }
+
+    // Interpolator for FDN reads while SIZE is moving (linear by default, as the reference)
+    void setDelayInterpolation(DelayBuffer::Interpolation newInterpolation)
+    {
+        interpolation = newInterpolation;
+    }
+
+    // Whole-sample FDN taps once SIZE settles (default on), which drops the
+    // interpolation and fractional index maths (see updateTapGlide). Off reads
+    // every tap fractionally, like the reference kernel (CinderVerify).
+    void setIntegerTaps(bool enabled) { integerTapsEnabled = enabled; }
+
+    // DC blocker on each line's feedback (default on). Off matches the
+    // reference kernel (CinderVerify).
+    void setDcBlocking(bool enabled) { dcBlocking = enabled; }
+
+    // Vectorised Pade tanh for BURN's saturation instead of std::tanh (within
+    // 1e-4, so no crossfade is needed); any time on the audio thread
+    void setFastBurn(bool fast) { fastBurn = fast; }
+
+    // Sample format of the FDN lines and pitch buffer (float16 / int16 halve the
+    // memory streamed per sample; the input diffusers stay float). Takes
+    // effect at the next prepare().
+    void setDelayStorage(SampleStorage newStorage) { storage = newStorage; }
+    SampleStorage getDelayStorage() const { return storage; }
+
+    // False once a NaN or infinity has been written to the FDN lines (checked
+    // once per governor interval); only reset() recovers
+    bool isStateFinite() const { return stateFinite; }
+
+    // Loop gain the energy governor currently applies (1 = not engaged)
+    float getGovernorGain() const { return governorGain; }
+
+    // Per-sample values for processBlock(), as passed to setParameters(),
+    // setBandDecay() and setModulation(). With `coefficients` set, those are
+    // applied through setCoefficients() instead and decay / shimmer / burn are
+    // not read (size must still hold each sample's coefficients[n].roomSize).
+    struct BlockControls
+    {
+        const float* decay;
+        const float* shimmer;
+        const float* size;
+        const float* burn;
+        const float* lowDecay;
+        const float* highDecay;
+        const float* modulation;
+        const Coefficients* coefficients = nullptr;
+    };
+
     float process(float input)
     {
-        // 1. Input diffusion (smears transients for smoother reverb)
+        return processNetwork(diffuse(input), -1);
+    }
+
+    // In place. Same result as applying the controls and calling process() per
+    // sample. Every delay reaches back further than a short sub-block, so each
+    // input allpass runs over a whole sub-block with vector loads and stores,
+    // and static FDN taps are read a sub-block ahead.
+    void processBlock(float* samples, int numSamples, const BlockControls& controls)
+    {
+        // 1. Input diffusion, a sub-block at a time (no feedback into it from the network)
+        for (int pos = 0; pos < numSamples; pos += diffuserBlockSize)
+            diffuseBlock(samples + pos, std::min(diffuserBlockSize, numSamples - pos));
+
+        // 2-7. The network, with static FDN taps fetched a sub-block ahead
+        for (int pos = 0; pos < numSamples;)
+        {
+            int count = std::min(numSamples - pos, maxSubBlock);
+            const bool prefetch = tapsStaticFor(controls, pos, count);
+            if (prefetch)
+            {
+                if (! integerTapsValid)
+                    updateIntegerTaps();
+                count = std::min(count, shortestIntegerTap);
+                for (int i = 0; i < fdnOrder; ++i)
+                    delayLines[i].readIntegerBlock(integerTaps[i], prefetchedTaps[i].data(), count);
+            }
+
+            for (int k = 0; k < count; ++k)
+            {
+                const int n = pos + k;
+                if (controls.coefficients != nullptr)
+                    setCoefficients(controls.coefficients[n]);
+                else
+                    setParameters(controls.decay[n], controls.shimmer[n], controls.size[n], controls.burn[n]);
+                setBandDecay(controls.lowDecay[n], controls.highDecay[n]);
+                setModulation(controls.modulation[n]);
+                samples[n] = processNetwork(samples[n], prefetch ? k : -1);
+            }
+            pos += count;
+        }
+    }
+
+private:
+    // Everything prepare() derives from the sample rate, apart from the FDN
+    // lines and pitch buffer (which also depend on the storage format)
+    void prepareForRate()
+    {
+        // Calculate delay times based on sample rate
+        // Using prime-ish numbers for inharmonic density
+        std::array<float, fdnOrder> baseDelayMs;
+        if constexpr (fdnOrder == 8)
+            baseDelayMs = {35.3f, 36.7f, 33.8f, 32.3f, 29.0f, 30.8f, 27.0f, 25.3f};
+        else
+            baseDelayMs = {35.3f, 33.8f, 29.0f, 27.0f};   // every other 8-line length
+
+        for (int i = 0; i < fdnOrder; ++i)
+        {
+            int delaySamples = static_cast<int>(baseDelayMs[i] * sampleRate / 1000.0f);
+            baseDelayTimes[i] = delaySamples;
+            baseDelayTaps[i] = static_cast<float>(delaySamples);
+        }
+
+        // The read offsets were for the old lengths: start back on them
+        tapOffsets.fill(0.0f);
+        glidingToWhole = false;
+        tapGlideCountdown = 0;
+
+        // LFOs: inharmonic rates, phases spread evenly over the lines
+        static constexpr std::array<float, 8> lfoRatesHz = {0.37f, 0.53f, 0.61f, 0.43f, 0.71f, 0.29f, 0.83f, 0.47f};
+        for (int i = 0; i < fdnOrder; ++i)
+        {
+            lfoIncrements[i] = lfoRatesHz[static_cast<size_t>(i * 8 / fdnOrder)] * modulationInterval
+                             / static_cast<float>(sampleRate);
+            lfoPhases[i] = static_cast<float>(i) / static_cast<float>(fdnOrder);
+        }
+
+        // Feedback DC blocker pole
+        dcBlockerPole = 1.0f - 2.0f * pi * dcBlockerHz / static_cast<float>(sampleRate);
+
+        // Band decay shelf corners (bilinear, prewarped)
+        lowShelfWarp = std::tan(pi * lowShelfHz / static_cast<float>(sampleRate));
+        highShelfWarp = std::tan(pi * highShelfHz / static_cast<float>(sampleRate));
+        bandDecayDirty = true;
+        bandDecayCountdown = 0;
+
+        // Input diffusers (allpass chain)
+        for (int i = 0; i < 4; ++i)
+            inputDiffusers[i].prepare(static_cast<int>(sampleRate * 0.05)); // 50ms max
+        velvetDiffuser.prepare(sampleRate);
+
+        // Sub-blocks the allpasses can run over: no longer than the shortest diffuser delay
+        diffuserBlockSize = maxSubBlock;
+        for (const float seconds : diffuserDelays)
+            diffuserBlockSize = std::min(diffuserBlockSize, std::max(1, static_cast<int>(static_cast<float>(seconds * sampleRate))));
+    }
+
+    // 1. Input diffusion (smears transients for smoother reverb)
+    static constexpr std::array<float, 4> diffuserDelays = {0.0042f, 0.0036f, 0.0029f, 0.0023f}; // seconds
+    static constexpr float diffuserGain = 0.6f;
+
+    float diffuse(float input)
+    {
         float diffused = input;
-        const std::array<float, 4> diffuserDelays = {0.0042f, 0.0036f, 0.0029f, 0.0023f}; // seconds
-        const float diffuserGain = 0.6f;
+        if (inputDiffusion == InputDiffusion::velvet)
+        {
+            diffused = velvetDiffuser.process(input);
+        }
+        else
+        {
+            for (int i = 0; i < 4; ++i)
+            {
+                float delaySamples = static_cast<float>(diffuserDelays[i] * sampleRate);
+                float delayed = inputDiffusers[i].popSample(delaySamples);
+                float toWrite = diffused + delayed * diffuserGain;
+                inputDiffusers[i].pushSample(toWrite);
+                diffused = delayed - diffused * diffuserGain;
+            }
+        }
+        return diffused;
+    }
 
+    // As diffuse() over numSamples <= diffuserBlockSize samples, in place:
+    // each allpass stage over the whole run before the next
+    void diffuseBlock(float* samples, int numSamples)
+    {
+        if (inputDiffusion == InputDiffusion::velvet)
+        {
+            for (int k = 0; k < numSamples; ++k)
+                samples[k] = velvetDiffuser.process(samples[k]);
+            return;
+        }
+
+        alignas(16) std::array<float, maxSubBlock> delayed, toWrite;
+        const SimdFloat gain = SimdFloat::broadcast(diffuserGain);
         for (int i = 0; i < 4; ++i)
         {
-            float delaySamples = static_cast<float>(diffuserDelays[i] * sampleRate);
-            float delayed = inputDiffusers[i].popSample(0, delaySamples);
-            float toWrite = diffused + delayed * diffuserGain;
-            inputDiffusers[i].pushSample(0, toWrite);
-            diffused = delayed - diffused * diffuserGain;
+            inputDiffusers[i].popBlock(static_cast<float>(diffuserDelays[i] * sampleRate), delayed.data(), numSamples);
+
+            int k = 0;
+            for (; k + SimdFloat::width <= numSamples; k += SimdFloat::width)
+            {
+                const SimdFloat x = SimdFloat::load(samples + k);
+                const SimdFloat d = SimdFloat::load(&delayed[k]);
+                (x + d * gain).store(&toWrite[k]);
+                (d - x * gain).store(samples + k);
+            }
+            for (; k < numSamples; ++k)
+            {
+                toWrite[k] = samples[k] + delayed[k] * diffuserGain;
+                samples[k] = delayed[k] - samples[k] * diffuserGain;
+            }
+
+            inputDiffusers[i].pushBlock(toWrite.data(), numSamples);
         }
+    }
+
+    // Whether every sample of the run takes the integer-tap path: SIZE has
+    // settled, holds at its current value and modulation is off
+    bool tapsStaticFor(const BlockControls& controls, int start, int count) const
+    {
+        if (! integerTapsEnabled || modulationActive || ! onWholeTaps())
+            return false;
+        for (int n = start; n < start + count; ++n)
+            if (controls.modulation[n] > 0.0f || std::clamp(controls.size[n], 0.0f, 1.0f) != roomSize)
+                return false;
+        return true;
+    }
 
+    // Steps 2-7 for one diffused sample; prefetched >= 0 takes the FDN taps
+    // from prefetchedTaps[line][prefetched] instead of reading the lines
+    float processNetwork(float diffused, int prefetched)
+    {
         // 2. Read from delay lines and apply Hadamard mixing
-        std::array<float, 8> delayOutputs;
-        for (int i = 0; i < 8; ++i)
+        std::array<float, fdnOrder> delayOutputs;
+        if (prefetched >= 0)
         {
-            // Modulate delay time by room size
-            float delayTime = baseDelayTimes[i] * (0.5f + roomSize);
-            delayOutputs[i] = delayLines[i].popSample(0, delayTime);
+            for (int i = 0; i < fdnOrder; ++i)
+                delayOutputs[i] = prefetchedTaps[i][static_cast<size_t>(prefetched)];
+        }
+        else
+        {
+            const bool modulated = modulationActive || modulationDepth > 0.0f;
+            updateTapGlide(modulated || sizeChanged || ! integerTapsEnabled);
+            sizeChanged = false;
+
+            if (modulated)
+            {
+                // LFO-modulated lengths: cubic reads on all lines at once
+                readModulated(delayOutputs);
+            }
+            else if (onWholeTaps())
+            {
+                // Settled SIZE: whole-sample taps, recomputed only after a change
+                if (! integerTapsValid)
+                    updateIntegerTaps();
+
+                for (int i = 0; i < fdnOrder; ++i)
+                    delayOutputs[i] = delayLines[i].readInteger(integerTaps[i]);
+            }
+            else
+            {
+                for (int i = 0; i < fdnOrder; ++i)
+                {
+                    // Modulate delay time by room size
+                    float delayTime = baseDelayTimes[i] * (0.5f + roomSize) + tapOffsets[i];
+                    delayOutputs[i] = delayLines[i].popSample(delayTime, interpolation);
+                }
+            }
         }
 
-        // 3. Hadamard matrix mixing (8x8, normalized)
+        // 3. Hadamard matrix mixing (NxN, normalized)
         // This creates dense, energy-preserving feedback
-        std::array<float, 8> mixed = hadamardMix(delayOutputs);
+        LineArray mixed = hadamardMix(delayOutputs);
 
-        // 4. Apply damping (one-pole lowpass), burn saturation, soft limiting, and feedback gain
-        for (int i = 0; i < 8; ++i)
+        // 4. Damping (one-pole lowpass), band decay, BURN drive and loop gain on all lines at once
+        if (bandDecayDirty && --bandDecayCountdown <= 0)
+            updateBandDecay();
+        if (--governorCountdown <= 0)
+            updateGovernor();
+        governorGain += governorStep;
+
+        // Feedback gain with shimmer compensation, scaled by the energy governor
+        const float loopGain = feedbackGain * shimmerCompensation * governorGain;
+        const bool burning = burnAmount > 0.0f;
         {
-            // Simple one-pole lowpass for damping
-            dampingFilters[i] = dampingFilters[i] + dampingCoeff * (mixed[i] - dampingFilters[i]);
+            const SimdFloat damping = SimdFloat::broadcast(dampingCoeff);
+            const SimdFloat dcPole = SimdFloat::broadcast(dcBlockerPole);
 
             // BURN: drive into soft limiter for progressive saturation per echo
-            // At burn=0: gain=1x (clean, no extra saturation)
+            // At burn=0: no saturation at all (the loop stays linear)
             // At burn=1: gain=5x (heavy drive into tanh limiter)
-            float burnGain = 1.0f + burnAmount * 4.0f;
-            float burned = dampingFilters[i] * burnGain;
-            float limited = softLimit(burned);
+            const SimdFloat gain = SimdFloat::broadcast(burning ? 1.0f + burnAmount * 4.0f : loopGain);
+
+            for (int i = 0; i < paddedOrder; i += SimdFloat::width)
+            {
+                SimdFloat lowpass = SimdFloat::load(&dampingFilters[i]);
+                lowpass = lowpass + damping * (SimdFloat::load(&mixed[i]) - lowpass);
+                lowpass.store(&dampingFilters[i]);
+
+                SimdFloat shaped = bandDecayActive ? bandDecay.process(lowpass, i) : lowpass;
 
-            // Apply feedback gain with shimmer compensation
-            mixed[i] = limited * feedbackGain * shimmerCompensation;
+                // One-pole DC blocker: nothing else in the loop removes DC, which
+                // otherwise builds up under BURN and infinite decay
+                if (dcBlocking)
+                {
+                    const SimdFloat blocked = shaped - SimdFloat::load(&dcInputs[i]) + dcPole * SimdFloat::load(&dcOutputs[i]);
+                    shaped.store(&dcInputs[i]);
+                    blocked.store(&dcOutputs[i]);
+                    shaped = blocked;
+                }
+
+                (shaped * gain).store(&mixed[i]);
+            }
+        }
+
+        if (burning && fastBurn)
+        {
+            const SimdFloat gain = SimdFloat::broadcast(loopGain);
+            for (int i = 0; i < paddedOrder; i += SimdFloat::width)
+                (fastSoftLimit(SimdFloat::load(&mixed[i])) * gain).store(&mixed[i]);
+        }
+        else if (burning)
+        {
+            for (int i = 0; i < fdnOrder; ++i)
+                mixed[i] = softLimit(mixed[i]) * loopGain;
         }
 
         // 5. Apply shimmer (pitch shift) in feedback
-        // Mix all 8 FDN channels into the pitch shifter for full-spectrum shimmer
+        // Mix all FDN channels into the pitch shifter for full-spectrum shimmer
         float shimmerInput = 0.0f;
-        for (int i = 0; i < 8; ++i)
+        for (int i = 0; i < fdnOrder; ++i)
             shimmerInput += mixed[i];
-        shimmerInput *= 0.125f; // normalize (1/8)
+        shimmerInput *= 1.0f / static_cast<float>(fdnOrder); // normalize (1/N)
         float pitchShifted = processPitchShift(shimmerInput);
 
-        // 6. Write to delay lines (input + feedback, with shimmer blended into all channels)
-        float inputContribution = diffused / 8.0f;
-        for (int i = 0; i < 8; ++i)
+        // 6. Write to delay lines (input + feedback, with shimmer blended into all channels).
+        // The saturator is only a last resort: the governor keeps the lines below its knee.
+        alignas(16) LineArray toWrite;
+        {
+            const float inputContribution = diffused / static_cast<float>(fdnOrder);
+            const float shimmerContrib = pitchShifted * shimmerMix * 0.5f;
+            const SimdFloat feed = SimdFloat::broadcast(inputContribution + shimmerContrib);
+            const SimdFloat knee = SimdFloat::broadcast(safetyKnee);
+            const SimdFloat negativeKnee = SimdFloat::broadcast(-safetyKnee);
+            const SimdFloat one = SimdFloat::broadcast(1.0f);
+            const SimdFloat slope = SimdFloat::broadcast(1.0f / (safetyCeiling - safetyKnee));
+
+            for (int i = 0; i < paddedOrder; i += SimdFloat::width)
+            {
+                // Linear up to the knee, then x / (1 + |x| / room) of the excess: approaches the ceiling
+                const SimdFloat x = SimdFloat::load(&mixed[i]) + feed;
+                const SimdFloat inside = min(max(x, negativeKnee), knee);
+                const SimdFloat excess = x - inside;
+                (inside + excess / (one + abs(excess) * slope)).store(&toWrite[i]);
+            }
+        }
+
+        for (int i = 0; i < fdnOrder; ++i)
         {
-            float shimmerContrib = pitchShifted * shimmerMix * 0.5f;
-            float toWrite = mixed[i] + inputContribution + shimmerContrib;
-            // Final safety limiter before writing to delay
-            delayLines[i].pushSample(0, softLimit(toWrite));
+            delayLines[i].pushSample(toWrite[i]);
+            governorEnergy += toWrite[i] * toWrite[i];
         }
 
         // 7. Output: sum all delay lines
         float output = 0.0f;
-        for (int i = 0; i < 8; ++i)
+        for (int i = 0; i < fdnOrder; ++i)
         {
             output += delayOutputs[i];
         }
-        return output * 0.25f; // Normalize output level
+        return output * outputScale; // Normalize output level
     }
 
-private:
     double sampleRate = 44100.0;
+    double preparedRate = 0.0;   // 0 until prepared (and after release())
+    SampleStorage preparedStorage = SampleStorage::float32;
+
+    // processBlock() runs: at most maxSubBlock samples, and no longer than the
+    // shortest delay they read from
+    static constexpr int maxSubBlock = 64;
+    int diffuserBlockSize = 1;
     
-    // 8-channel FDN
-    std::array<juce::dsp::DelayLine<float>, 8> delayLines;
-    std::array<int, 8> baseDelayTimes;
-    std::array<float, 8> delayLineStates{};
+    // Per-line state padded to whole SimdFloat registers (the padding lanes stay 0)
+    static constexpr int paddedOrder = (fdnOrder + SimdFloat::width - 1) / SimdFloat::width * SimdFloat::width;
+    using LineArray = std::array<float, paddedOrder>;
+
+    // N-channel FDN
+    std::array<DelayBuffer, fdnOrder> delayLines;
+    std::array<int, fdnOrder> baseDelayTimes;
+    alignas(16) LineArray baseDelayTaps{};
+    std::array<float, fdnOrder> delayLineStates{};
+
+    // Whole-sample line lengths for the current SIZE
+    std::array<int, fdnOrder> integerTaps{};
+    int shortestIntegerTap = 1;
+    std::array<std::array<float, maxSubBlock>, fdnOrder> prefetchedTaps{};
+    bool integerTapsValid = false;
+    bool integerTapsEnabled = true;
+    bool sizeChanged = true;   // since the last read
+
+    // Read offsets (samples) from the SIZE-scaled lengths: gliding onto the
+    // whole-sample taps, or back to 0 while the lengths move (updateTapGlide)
+    static constexpr int tapGlideSamples = 256;
+    alignas(16) LineArray tapOffsets{}, tapOffsetSteps{}, tapOffsetTargets{};
+    bool glidingToWhole = false;
+    int tapGlideCountdown = 0;
+    DelayBuffer::Interpolation interpolation = DelayBuffer::Interpolation::linear;
+    SampleStorage storage = SampleStorage::float32;
+
+    // Line length modulation: offsets (samples) ramp towards the LFO targets
+    static constexpr int modulationInterval = 32;        // samples between LFO updates
+    static constexpr float maxModulationSeconds = 0.0005f;
+    alignas(16) LineArray modulationOffsets{}, modulationTargets{}, modulationSteps{};
+    std::array<float, fdnOrder> lfoPhases{}, lfoIncrements{};
+    float modulationDepth = 0.0f;
+    bool modulationActive = false;
+    int modulationCountdown = 0;
     
     // Input diffusers
-    std::array<juce::dsp::DelayLine<float>, 4> inputDiffusers;
+    std::array<DelayBuffer, 4> inputDiffusers;
+    VelvetDiffuser velvetDiffuser;
+    InputDiffusion inputDiffusion = InputDiffusion::allpass;
     
     // Damping filters (simple one-pole state)
-    std::array<float, 8> dampingFilters{};
+    alignas(16) LineArray dampingFilters{};
     float dampingCoeff = 0.7f;
+
+    // Feedback DC blockers (one-pole highpass per line)
+    static constexpr float dcBlockerHz = 2.0f;
+    alignas(16) LineArray dcInputs{}, dcOutputs{};
+    float dcBlockerPole = 0.9997f;
+    bool dcBlocking = true;
+
+    // Band decay: one biquad per line (low shelf x high shelf), transposed direct form II
+    struct BandDecayFilters
+    {
+        alignas(16) LineArray b0{}, b1{}, b2{}, a1{}, a2{};
+        alignas(16) LineArray z1{}, z2{};
+
+        SimdFloat process(SimdFloat x, int i)
+        {
+            const SimdFloat y = SimdFloat::load(&b0[i]) * x + SimdFloat::load(&z1[i]);
+            (SimdFloat::load(&b1[i]) * x - SimdFloat::load(&a1[i]) * y + SimdFloat::load(&z2[i])).store(&z1[i]);
+            (SimdFloat::load(&b2[i]) * x - SimdFloat::load(&a2[i]) * y).store(&z2[i]);
+            return y;
+        }
+
+        void clear()
+        {
+            z1.fill(0.0f);
+            z2.fill(0.0f);
+        }
+    };
+
+    static constexpr float lowShelfHz = 250.0f;
+    static constexpr float highShelfHz = 4000.0f;
+    static constexpr int bandDecayInterval = 32;   // samples between coefficient updates while parameters move
+    BandDecayFilters bandDecay;
+    float lowShelfWarp = 0.0f, highShelfWarp = 0.0f;
+    float lowDecayMultiplier = 1.0f, highDecayMultiplier = 1.0f;
+    float decayTime = 2.0f;
+    bool bandDecayActive = false;
+    bool bandDecayDirty = true;
+    int bandDecayCountdown = 0;
     
     // Parameters
     float feedbackGain = 0.85f;
     float shimmerMix = 0.0f;
     float roomSize = 0.5f;
     float shimmerCompensation = 1.0f;
+
+    // Energy governor on the feedback loop (see updateGovernor)
+    static constexpr int governorInterval = 32;         // samples
+    static constexpr float governorTargetRms = 0.6f;    // per line
+    static constexpr float governorBurnHeadroom = 0.35f; // extra target at full BURN (its saturation bounds peaks)
+    static constexpr float governorRelease = 0.02f;     // per interval (~70 ms at 48 kHz)
+    static constexpr float safetyKnee = 0.8f;           // last-resort saturator on line writes
+    static constexpr float safetyCeiling = 1.0f;
+    float governorGain = 1.0f, governorTarget = 1.0f, governorStep = 0.0f;
+    float governorEnergy = 0.0f;
+    int governorCountdown = governorInterval;
+    bool stateFinite = true;   // false for good once a non-finite write was measured
     float burnAmount = 0.0f;
+    bool fastBurn = false;
 
     // Pitch shifter state (dual-grain overlap-add)
-    std::vector<float> pitchShiftBuffer;
+    SampleBuffer pitchShiftBuffer;
     int pitchShiftWritePos = 0;
+    int pitchShiftWritten = 0;   // slots written since reset(), up to the buffer size
     float grainReadPos[2] = {0.0f, 0.0f};   // Two overlapping grains
     int grainPhase[2] = {0, 0};               // Phase counter per grain
     static constexpr int grainSize = 1024;     // Grain length in samples
+    static constexpr float pi = 3.14159265358979323846f;
 
-    // Soft limiter to prevent runaway - uses tanh for smooth limiting
+    // The line sum grows with sqrt(N); scale so both orders sit at the 8-line level
+    static constexpr float outputScale = fdnOrder == 8 ? 0.25f : 0.17677670f;
+
+    // Shelf gains: the extra gain per pass through line i that scales the
+    // band's RT60 (a pass attenuates by 10^(-3 L / RT60)). The highs are
+    // measured at 8 kHz, including the damping lowpass.
+    void updateBandDecay()
+    {
+        bandDecayDirty = false;
+        bandDecayCountdown = bandDecayInterval;
+
+        const bool wasActive = bandDecayActive;
+        bandDecayActive = decayTime <= 50.0f && (lowDecayMultiplier != 1.0f || highDecayMultiplier != 1.0f);
+        if (! bandDecayActive)
+        {
+            if (wasActive)
+                bandDecay.clear();
+            return;
+        }
+
+        // Never let a band's loop gain reach the infinite-mode ceiling
+        const float maxBandGain = 0.998f / std::max(feedbackGain * shimmerCompensation, 1.0e-3f);
+
+        const float w = 2.0f * pi * std::min(2.0f * highShelfHz, 0.45f * static_cast<float>(sampleRate))
+                      / static_cast<float>(sampleRate);
+        const float pole = 1.0f - dampingCoeff;
+        const float dampingLog = 0.5f * std::log10(dampingCoeff * dampingCoeff
+                                                   / (1.0f - 2.0f * pole * std::cos(w) + pole * pole));
+
+        for (int i = 0; i < fdnOrder; ++i)
+        {
+            const float lineSeconds = baseDelayTimes[i] * (0.5f + roomSize) / static_cast<float>(sampleRate);
+            const float perPass = -3.0f * lineSeconds / decayTime;
+            const float lowGain = std::min(std::pow(10.0f, perPass * (1.0f / lowDecayMultiplier - 1.0f)), maxBandGain);
+            const float highGain = std::min(std::pow(10.0f, (perPass + dampingLog) * (1.0f / highDecayMultiplier - 1.0f)),
+                                            maxBandGain);
+
+            // First-order shelves: low (s + G) / (s + 1), high (G s + 1) / (s + 1), s normalised to the corner
+            const float tl = lowShelfWarp, th = highShelfWarp;
+            const float lowB0 = (1.0f + lowGain * tl) / (1.0f + tl), lowB1 = (lowGain * tl - 1.0f) / (1.0f + tl);
+            const float lowA1 = (tl - 1.0f) / (1.0f + tl);
+            const float highB0 = (highGain + th) / (1.0f + th), highB1 = (th - highGain) / (1.0f + th);
+            const float highA1 = (th - 1.0f) / (1.0f + th);
+
+            bandDecay.b0[i] = lowB0 * highB0;
+            bandDecay.b1[i] = lowB0 * highB1 + lowB1 * highB0;
+            bandDecay.b2[i] = lowB1 * highB1;
+            bandDecay.a1[i] = lowA1 + highA1;
+            bandDecay.a2[i] = lowA1 * highA1;
+        }
+    }
+
+    // Control-rate LFO step: lands the offsets on the previous targets and
+    // aims them at the next ones. Goes idle once depth 0 has been reached.
+    void updateModulation()
+    {
+        modulationCountdown = modulationInterval;
+        modulationOffsets = modulationTargets;
+
+        const float depthSamples = modulationDepth * maxModulationSeconds * static_cast<float>(sampleRate);
+        modulationActive = depthSamples > 0.0f
+                        || std::any_of(modulationOffsets.begin(), modulationOffsets.end(), [](float x) { return x != 0.0f; });
+
+        for (int i = 0; i < fdnOrder; ++i)
+        {
+            lfoPhases[i] += lfoIncrements[i];
+            if (lfoPhases[i] >= 1.0f)
+                lfoPhases[i] -= 1.0f;
+
+            modulationTargets[i] = depthSamples * std::sin(2.0f * pi * lfoPhases[i]);
+            modulationSteps[i] = (modulationTargets[i] - modulationOffsets[i]) * (1.0f / modulationInterval);
+        }
+
+        // Restart promptly when depth comes back
+        if (! modulationActive)
+            modulationCountdown = 0;
+    }
+
+    void readModulated(std::array<float, fdnOrder>& outputs)
+    {
+        if (--modulationCountdown <= 0)
+            updateModulation();
+
+        // Tap positions: SIZE-scaled length plus the ramping offset
+        // (the lines have 4x headroom, so only the lower bound needs a clamp)
+        alignas(16) LineArray taps;
+        const SimdFloat sizeScale = SimdFloat::broadcast(0.5f + roomSize);
+        const SimdFloat minTap = SimdFloat::broadcast(2.0f);
+        for (int i = 0; i < paddedOrder; i += SimdFloat::width)
+        {
+            const SimdFloat offset = SimdFloat::load(&modulationOffsets[i]) + SimdFloat::load(&modulationSteps[i]);
+            offset.store(&modulationOffsets[i]);
+            max(SimdFloat::load(&baseDelayTaps[i]) * sizeScale + offset + SimdFloat::load(&tapOffsets[i]), minTap)
+                .store(&taps[i]);
+        }
+
+        // Gather each line's four neighbours (separate buffers, so scalar loads)
+        alignas(16) LineArray fraction{}, ym1{}, y0{}, y1{}, y2{};
+        for (int i = 0; i < fdnOrder; ++i)
+        {
+            const int whole = static_cast<int>(taps[i]);
+            fraction[i] = taps[i] - static_cast<float>(whole);
+            delayLines[i].readCubicTaps(whole, ym1[i], y0[i], y1[i], y2[i]);
+        }
+
+        // 4-point Catmull-Rom, as DelayBuffer::popSampleCubic
+        alignas(16) LineArray interpolated;
+        const SimdFloat half = SimdFloat::broadcast(0.5f);
+        for (int i = 0; i < paddedOrder; i += SimdFloat::width)
+        {
+            const SimdFloat t = SimdFloat::load(&fraction[i]);
+            const SimdFloat a = SimdFloat::load(&ym1[i]), b = SimdFloat::load(&y0[i]);
+            const SimdFloat c = SimdFloat::load(&y1[i]), d = SimdFloat::load(&y2[i]);
+
+            const SimdFloat c1 = half * (c - a);
+            const SimdFloat c2 = a - SimdFloat::broadcast(2.5f) * b + SimdFloat::broadcast(2.0f) * c - half * d;
+            const SimdFloat c3 = half * (d - a) + SimdFloat::broadcast(1.5f) * (b - c);
+            (((c3 * t + c2) * t + c1) * t + b).store(&interpolated[i]);
+        }
+
+        std::copy_n(interpolated.begin(), fdnOrder, outputs.begin());
+    }
+
+    bool onWholeTaps() const { return glidingToWhole && tapGlideCountdown == 0; }
+
+    // Once per read: while the lengths move (SIZE, MOD) the tap offsets glide
+    // to 0, and once they hold still they glide to the whole-sample taps, each
+    // over tapGlideSamples from wherever they are. Linear reads at the end of
+    // a glide land on the whole samples the integer reads then take, so
+    // starting or stopping automation never steps the tail by the rounding.
+    void updateTapGlide(bool moving)
+    {
+        if (moving == glidingToWhole)
+        {
+            glidingToWhole = ! moving;
+            if (glidingToWhole)
+            {
+                if (! integerTapsValid)
+                    updateIntegerTaps();
+                for (int i = 0; i < fdnOrder; ++i)
+                    tapOffsetTargets[i] = static_cast<float>(integerTaps[i]) - baseDelayTimes[i] * (0.5f + roomSize);
+            }
+            else
+            {
+                tapOffsetTargets.fill(0.0f);
+            }
+
+            for (int i = 0; i < fdnOrder; ++i)
+                tapOffsetSteps[i] = (tapOffsetTargets[i] - tapOffsets[i]) * (1.0f / tapGlideSamples);
+            tapGlideCountdown = tapGlideSamples;
+        }
+
+        if (tapGlideCountdown > 0)
+        {
+            for (int i = 0; i < paddedOrder; i += SimdFloat::width)
+                (SimdFloat::load(&tapOffsets[i]) + SimdFloat::load(&tapOffsetSteps[i])).store(&tapOffsets[i]);
+            if (--tapGlideCountdown == 0)
+                tapOffsets = tapOffsetTargets;
+        }
+    }
+
+    void updateIntegerTaps()
+    {
+        for (int i = 0; i < fdnOrder; ++i)
+        {
+            const float delayTime = baseDelayTimes[i] * (0.5f + roomSize);
+            integerTaps[i] = std::clamp(static_cast<int>(std::lround(delayTime)), 1,
+                                        delayLines[i].getMaximumDelayInSamples());
+        }
+        shortestIntegerTap = *std::min_element(integerTaps.begin(), integerTaps.end());
+        integerTapsValid = true;
+    }
+
+    // Feedback energy governor, once per interval: if the mean square written
+    // to the lines was above the target (more with BURN, whose saturation
+    // already bounds the peaks), aim the loop gain at the level that would
+    // have met it (attack within one interval); otherwise let it recover
+    // towards 1. The gain ramps linearly between updates. This is what keeps
+    // SHIMMER, BURN, infinite decay and FREEZE bounded; the saturator on the
+    // line writes is only a last resort.
+    void updateGovernor()
+    {
+        governorCountdown = governorInterval;
+        governorGain = governorTarget;
+
+        const float meanSquare = governorEnergy / static_cast<float>(governorInterval * fdnOrder);
+        governorEnergy = 0.0f;
+        if (! std::isfinite(meanSquare))
+            stateFinite = false;
+
+        const float targetRms = governorTargetRms + governorBurnHeadroom * burnAmount;
+        if (meanSquare > targetRms * targetRms)
+            governorTarget = std::max(governorTarget * targetRms / std::sqrt(meanSquare), 0.5f * governorTarget);
+        else
+            governorTarget += (1.0f - governorTarget) * governorRelease;
+
+        governorStep = (governorTarget - governorGain) / static_cast<float>(governorInterval);
+    }
+
+    // softLimit() on whole registers, branchless, with a Pade tanh (input
+    // clamped to +-5, within 1e-4 of std::tanh) as in the batch kernels
+    static SimdFloat fastSoftLimit(SimdFloat x)
+    {
+        const SimdFloat threshold = SimdFloat::broadcast(0.8f);
+        const SimdFloat ax = abs(x);
+        const SimdFloat excess = min(max(ax - threshold, SimdFloat::broadcast(0.0f)) * SimdFloat::broadcast(2.0f),
+                                     SimdFloat::broadcast(5.0f));
+        const SimdFloat e2 = excess * excess;
+        const SimdFloat num = excess * (SimdFloat::broadcast(135135.0f) + e2 * (SimdFloat::broadcast(17325.0f) + e2 * (SimdFloat::broadcast(378.0f) + e2)));
+        const SimdFloat den = SimdFloat::broadcast(135135.0f) + e2 * (SimdFloat::broadcast(62370.0f) + e2 * (SimdFloat::broadcast(3150.0f) + e2 * SimdFloat::broadcast(28.0f)));
+        return copysign(min(ax, threshold) + SimdFloat::broadcast(0.2f) * (num / den), x);
+    }
+
+    // Soft limiter for BURN's saturation - uses tanh for smooth limiting
     float softLimit(float x)
     {
         // Threshold above which we start limiting
@@ -227,21 +948,21 @@ private:
         return sign * limited;
     }
 
-    // Hadamard matrix multiplication (8x8)
-    std::array<float, 8> hadamardMix(const std::array<float, 8>& input)
+    // Hadamard matrix multiplication (NxN), into a padded line array
+    LineArray hadamardMix(const std::array<float, fdnOrder>& input)
     {
-        // Normalized 8x8 Hadamard matrix
-        // Each row/column has entries of +1 or -1, normalized by 1/sqrt(8)
-        const float norm = 1.0f / std::sqrt(8.0f);
+        // Normalized NxN Hadamard matrix
+        // Each row/column has entries of +1 or -1, normalized by 1/sqrt(N)
+        const float norm = 1.0f / std::sqrt(static_cast<float>(fdnOrder));
         
-        std::array<float, 8> output;
+        LineArray output{};
         
         // Using the recursive Hadamard structure
         // H8 = [[H4, H4], [H4, -H4]]
-        for (int i = 0; i < 8; ++i)
+        for (int i = 0; i < fdnOrder; ++i)
         {
             float sum = 0.0f;
-            for (int j = 0; j < 8; ++j)
+            for (int j = 0; j < fdnOrder; ++j)
             {
                 // Hadamard entry: (-1)^(popcount(i & j))
                 int bits = i & j;
@@ -260,12 +981,20 @@ private:
     // Two grains with 50% overlap and Hann windowing for artifact-free output
     float processPitchShift(float input)
     {
-        const int bufSize = static_cast<int>(pitchShiftBuffer.size());
+        const int bufSize = pitchShiftBuffer.size();
         const float pitchRatio = 2.0f;
 
         // Write to circular buffer
-        pitchShiftBuffer[pitchShiftWritePos] = input;
+        pitchShiftBuffer.write(pitchShiftWritePos, input);
         pitchShiftWritePos = (pitchShiftWritePos + 1) % bufSize;
+        if (pitchShiftWritten < bufSize)
+            ++pitchShiftWritten;
+
+        // Slots written before the last reset read as 0 (see DelayBuffer)
+        auto readPitch = [&](int index) {
+            const int age = (pitchShiftWritePos - index - 1 + bufSize) % bufSize;
+            return age < pitchShiftWritten ? pitchShiftBuffer.read(index) : 0.0f;
+        };
 
         float output = 0.0f;
 
@@ -278,14 +1007,14 @@ private:
 
             // Hann window based on grain phase
             float phase = static_cast<float>(grainPhase[g]) / static_cast<float>(grainSize);
-            float window = 0.5f - 0.5f * std::cos(2.0f * juce::MathConstants<float>::pi * phase);
+            float window = 0.5f - 0.5f * std::cos(2.0f * pi * phase);
 
             // Linear interpolation read
             int readIdx = static_cast<int>(grainReadPos[g]);
             float frac = grainReadPos[g] - static_cast<float>(readIdx);
             int nextIdx = (readIdx + 1) % bufSize;
-            float sample = pitchShiftBuffer[readIdx] * (1.0f - frac) +
-                           pitchShiftBuffer[nextIdx] * frac;
+            float sample = readPitch(readIdx) * (1.0f - frac) +
+                           readPitch(nextIdx) * frac;
 
             output += sample * window;
 
@@ -302,3 +1031,5 @@ private:
         return output;
     }
 };
+
+using ShimmerReverb = BasicShimmerReverb<8>;
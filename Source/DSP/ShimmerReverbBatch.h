@@ -0,0 +1,284 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+#include "ShimmerBatchState.h"
+#include "Kernels/Kernels.h"
+
+/**
+ * ShimmerReverbBatch - 16 independent ShimmerReverbs processed in SIMD lanes
+ *
+ * Same topology as ShimmerReverb (4 input allpasses, 8-line FDN, Hadamard
+ * feedback, damping, BURN, soft limiting, octave-up shimmer), but lane k of
+ * every state value belongs to instance k. The per-sample kernel runs on
+ * whole registers (SSE2: 4 lanes, AVX2: 8, AVX-512: 16); it is picked by
+ * CPUID in prepare() from Kernels/.
+ *
+ * Lanes are split into register-wide groups. Groups never interact, so each
+ * one runs a whole block with its filter state and coefficients in registers.
+ * Memory is [group][line][frame][width]:
+ * - Diffusers and the pitch buffer use the same delay in every lane, so
+ *   their reads and all writes are contiguous vector loads/stores.
+ * - FDN reads depend on each lane's SIZE, so they are gathers.
+ *
+ * setDelayStorage() can pack the FDN lines and pitch buffer as float16 or
+ * int16, converted in registers on every load/store. That halves the delay
+ * memory the bank streams through per sample.
+ *
+ * Differences from looping over ShimmerReverb objects:
+ * - parameters are control-rate (per block) and ramped linearly across the
+ *   block, instead of recomputed every sample
+ * - the Hadamard mix is a fast Walsh-Hadamard transform (24 adds)
+ * - the limiter's tanh is a Pade approximant (branchless, vectorisable)
+ * - the grain windows are a table shared by all lanes
+ */
+class ShimmerReverbBatch
+{
+public:
+    static constexpr int numLanes = ShimmerBatchState::numLanes;
+
+    ShimmerReverbBatch() = default;
+
+    // state points into the owned buffers
+    ShimmerReverbBatch(const ShimmerReverbBatch&) = delete;
+    ShimmerReverbBatch& operator=(const ShimmerReverbBatch&) = delete;
+
+    void prepare(double sr, int maxBlockSize)
+    {
+        sampleRate = sr;
+        maxBlock = std::max(1, maxBlockSize);
+
+        // The kernel's register width decides the memory layout
+        kernels = &getKernels();
+        state.width = kernels->width;
+
+        // Same prime-ish line lengths as ShimmerReverb
+        const std::array<float, numLines> baseDelayMs = {35.3f, 36.7f, 33.8f, 32.3f, 29.0f, 30.8f, 27.0f, 25.3f};
+
+        int longest = 0;
+        for (int i = 0; i < numLines; ++i)
+        {
+            baseDelayTimes[i] = static_cast<int>(baseDelayMs[i] * sampleRate / 1000.0f);
+            longest = std::max(longest, baseDelayTimes[i]);
+        }
+
+        // SIZE scales delays by 0.5..1.5
+        maxLineDelay = static_cast<float>(longest) * 1.5f;
+        state.fdnFrames = nextPowerOfTwo(static_cast<int>(maxLineDelay) + 2);
+        state.storage = storage;
+        state.fdnMemory = allocateDelayMemory(fdnMemory, packedFdnMemory, static_cast<size_t>(numLines) * state.fdnFrames * numLanes);
+
+        // Input diffusers have fixed, lane-independent delays
+        const std::array<float, numDiffusers> diffuserDelays = {0.0042f, 0.0036f, 0.0029f, 0.0023f}; // seconds
+        state.diffuserFrames = nextPowerOfTwo(static_cast<int>(diffuserDelays[0] * sampleRate) + 2);
+        diffuserMemory.assign(static_cast<size_t>(numDiffusers) * state.diffuserFrames * numLanes, 0.0f);
+        state.diffuserMemory = diffuserMemory.data();
+        for (int i = 0; i < numDiffusers; ++i)
+        {
+            const float d = static_cast<float>(diffuserDelays[i] * sampleRate);
+            state.diffuserDelayInt[i] = static_cast<int>(d);
+            state.diffuserDelayFrac[i] = d - static_cast<float>(state.diffuserDelayInt[i]);
+        }
+
+        // Pitch shifter (dual-grain overlap-add), 500ms buffer
+        state.pitchFrames = static_cast<int>(sampleRate * 0.5);
+        state.pitchMemory = allocateDelayMemory(pitchMemory, packedPitchMemory, static_cast<size_t>(state.pitchFrames) * numLanes);
+
+        for (int p = 0; p < grainSize; ++p)
+        {
+            const float phase = static_cast<float>(p) / static_cast<float>(grainSize);
+            state.grainWindow[p] = 0.5f - 0.5f * std::cos(2.0f * pi * phase);
+        }
+
+        // Block-major I/O scratch, transposed to lane-interleaved frames
+        ioScratch.assign(static_cast<size_t>(maxBlock * numLanes), 0.0f);
+
+        for (int k = 0; k < numLanes; ++k)
+            setParameters(k, 2.0f, 0.0f, 0.5f, 0.0f);
+
+        reset();
+    }
+
+    void reset()
+    {
+        std::fill(fdnMemory.begin(), fdnMemory.end(), 0.0f);
+        std::fill(diffuserMemory.begin(), diffuserMemory.end(), 0.0f);
+        std::fill(pitchMemory.begin(), pitchMemory.end(), 0.0f);
+        std::fill(packedFdnMemory.begin(), packedFdnMemory.end(), std::uint16_t { 0 });
+        std::fill(packedPitchMemory.begin(), packedPitchMemory.end(), std::uint16_t { 0 });
+        for (auto& line : state.dampingFilters)
+            std::fill(std::begin(line), std::end(line), 0.0f);
+
+        state.positions = {};
+        state.positions.grainPhase[1] = grainSize / 2;  // Second grain starts 50% offset
+
+        // Start from the targets instead of ramping into them
+        state.current = target;
+    }
+
+    // Silences one instance (e.g. a new emitter) without touching the others
+    void resetLane(int lane)
+    {
+        if (lane < 0 || lane >= numLanes)
+            return;
+
+        // Memory is [group][...][width]; clear every width-th sample of the lane's group.
+        // Only one of each float / packed pair is allocated.
+        const int width = state.width;
+        auto clearLane = [lane, width](auto& memory, int framesPerGroup) {
+            const size_t groupSize = static_cast<size_t>(framesPerGroup) * static_cast<size_t>(width);
+            const size_t first = static_cast<size_t>(lane / width) * groupSize + static_cast<size_t>(lane % width);
+            for (size_t i = first; i < first + groupSize && i < memory.size(); i += width)
+                memory[i] = 0;
+        };
+        clearLane(fdnMemory, numLines * state.fdnFrames);
+        clearLane(packedFdnMemory, numLines * state.fdnFrames);
+        clearLane(diffuserMemory, numDiffusers * state.diffuserFrames);
+        clearLane(pitchMemory, state.pitchFrames);
+        clearLane(packedPitchMemory, state.pitchFrames);
+        for (auto& line : state.dampingFilters)
+            line[lane] = 0.0f;
+    }
+
+    // Control-rate parameters for one lane, same meaning as ShimmerReverb::setParameters.
+    // Applied with a linear ramp across the next process() call.
+    void setParameters(int lane, float decaySeconds, float shimmerAmount, float size, float burn)
+    {
+        if (lane < 0 || lane >= numLanes)
+            return;
+
+        float feedbackGain;
+        if (decaySeconds > 50.0f)
+        {
+            // "Infinite" mode - still slightly below unity for stability
+            feedbackGain = 0.9985f;
+        }
+        else
+        {
+            const float avgDelaySeconds = 0.030f;
+            feedbackGain = std::clamp(std::pow(10.0f, -3.0f * avgDelaySeconds / decaySeconds), 0.0f, 0.998f);
+        }
+
+        const float roomSize = std::clamp(size, 0.0f, 1.0f);
+        const float shimmerCompensation = 1.0f - (shimmerAmount * 0.08f);
+
+        target.loopGain[lane] = feedbackGain * shimmerCompensation;
+        target.damping[lane] = 0.2f + roomSize * 0.4f;
+        target.burnGain[lane] = 1.0f + std::clamp(burn, 0.0f, 1.0f) * 4.0f;
+        target.shimmerSend[lane] = shimmerAmount * 0.5f;
+        for (int i = 0; i < numLines; ++i)
+            target.delay[i][lane] = std::min(static_cast<float>(baseDelayTimes[i]) * (0.5f + roomSize), maxLineDelay);
+    }
+
+    /**
+     * inputs[k] / outputs[k] are instance k's mono buffers. A null input is
+     * silence; a null output is discarded. numSamples may exceed the prepared
+     * block size (it is split internally).
+     */
+    void process(const float* const* inputs, float* const* outputs, int numSamples)
+    {
+        for (int pos = 0; pos < numSamples; pos += maxBlock)
+        {
+            const int n = std::min(maxBlock, numSamples - pos);
+
+            // Transpose in: [lane][sample] -> [sample][lane]
+            for (int k = 0; k < numLanes; ++k)
+            {
+                const float* in = inputs[k];
+                for (int s = 0; s < n; ++s)
+                    ioScratch[static_cast<size_t>(s * numLanes + k)] = in != nullptr ? in[pos + s] : 0.0f;
+            }
+
+            processInterleaved(ioScratch.data(), n);
+
+            // Transpose out
+            for (int k = 0; k < numLanes; ++k)
+            {
+                if (float* out = outputs[k])
+                    for (int s = 0; s < n; ++s)
+                        out[pos + s] = ioScratch[static_cast<size_t>(s * numLanes + k)];
+            }
+        }
+    }
+
+    // In-place on lane-interleaved frames (frame s, lane k at io[s * numLanes + k])
+    void processInterleaved(float* io, int numSamples)
+    {
+        if (numSamples <= 0)
+            return;
+
+        // Per-block linear ramps toward the latest parameters
+        auto& current = state.current;
+        auto& step = state.step;
+        const float invN = 1.0f / static_cast<float>(numSamples);
+        for (int k = 0; k < numLanes; ++k)
+        {
+            step.loopGain[k] = (target.loopGain[k] - current.loopGain[k]) * invN;
+            step.damping[k] = (target.damping[k] - current.damping[k]) * invN;
+            step.burnGain[k] = (target.burnGain[k] - current.burnGain[k]) * invN;
+            step.shimmerSend[k] = (target.shimmerSend[k] - current.shimmerSend[k]) * invN;
+            for (int i = 0; i < numLines; ++i)
+                step.delay[i][k] = (target.delay[i][k] - current.delay[i][k]) * invN;
+        }
+
+        kernels->shimmerBatch(state, io, numSamples);
+
+        // Land exactly on the targets (no drift from accumulated steps)
+        current = target;
+    }
+
+    // Instruction set of the kernel chosen in prepare()
+    SimdLevel getSimdLevel() const { return kernels->level; }
+
+    // Sample format of the FDN lines and pitch buffer; takes effect at the next prepare()
+    void setDelayStorage(SampleStorage newStorage) { storage = newStorage; }
+    SampleStorage getDelayStorage() const { return storage; }
+
+private:
+    static constexpr int numLines = ShimmerBatchState::numLines;
+    static constexpr int numDiffusers = ShimmerBatchState::numDiffusers;
+    static constexpr int grainSize = ShimmerBatchState::grainSize;
+    static constexpr float pi = 3.14159265358979323846f;
+
+    double sampleRate = 44100.0;
+    int maxBlock = 512;
+
+    const CinderKernels* kernels = &getKernels();
+    ShimmerBatchState state;
+    ShimmerBatchState::Coefficients target;
+
+    // Owned memory behind state's pointers. The FDN and pitch memory live in
+    // the float or the packed vector, depending on the storage format.
+    SampleStorage storage = SampleStorage::float32;
+    std::vector<float> fdnMemory, diffuserMemory, pitchMemory;
+    std::vector<std::uint16_t> packedFdnMemory, packedPitchMemory;   // half bits, or int16 (same size, may alias)
+    std::array<int, numLines> baseDelayTimes {};
+    float maxLineDelay = 0.0f;
+
+    std::vector<float> ioScratch;
+
+    void* allocateDelayMemory(std::vector<float>& floats, std::vector<std::uint16_t>& packed, size_t numSamples)
+    {
+        if (storage == SampleStorage::float32)
+        {
+            packed = {};
+            floats.assign(numSamples, 0.0f);
+            return floats.data();
+        }
+
+        floats = {};
+        packed.assign(numSamples + 1, 0);   // +1: a 16-bit gather reads 32 bits
+        return packed.data();
+    }
+
+    static int nextPowerOfTwo(int n)
+    {
+        int p = 1;
+        while (p < n)
+            p <<= 1;
+        return p;
+    }
+};
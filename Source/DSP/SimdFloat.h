@@ -0,0 +1,453 @@
+#pragma once
+
+#include "SampleStorage.h"
+#include <cmath>
+#include <cstdint>
+
+#if defined(__AVX512F__) || defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+ #include <immintrin.h>
+#endif
+
+/**
+ * SimdFloat / SimdInt - Minimal float/int32 vector types for lane-parallel DSP
+ *
+ * The register width follows the flags the translation unit is compiled with:
+ *   AVX-512F -> 16 lanes, AVX2 -> 8 lanes, SSE2 -> 4 lanes, otherwise 1 (scalar)
+ *
+ * Only what the batch kernels need: arithmetic, min/max/abs/copysign, float <->
+ * int conversion, integer index maths, gathers and horizontal reductions.
+ * Loads/stores are unaligned.
+ *
+ * Packed delay memory (see SampleStorage.h) converts on load/store: float16
+ * with F16C on AVX2 / AVX-512, with integer bit operations on SSE2; int16
+ * scaled by 32767 with saturating packs. The 16-bit gathers fetch 32 bits per
+ * lane, so packed memory needs one element of padding after its last frame.
+ *
+ * Each variant lives in its own inline namespace (simd_avx512, simd_avx2, ...),
+ * so translation units built with different ISA flags never define the same
+ * symbol differently (see Kernels/).
+ */
+
+#if defined(__AVX512F__)
+
+inline namespace simd_avx512
+{
+
+struct SimdInt
+{
+    static constexpr int width = 16;
+    __m512i v;
+
+    static SimdInt broadcast(int x) { return { _mm512_set1_epi32(x) }; }
+    static SimdInt iota() { return { _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15) }; }
+    static SimdInt load(const std::int32_t* p) { return { _mm512_loadu_si512(p) }; }
+    friend SimdInt operator+(SimdInt a, SimdInt b) { return { _mm512_add_epi32(a.v, b.v) }; }
+    friend SimdInt operator-(SimdInt a, SimdInt b) { return { _mm512_sub_epi32(a.v, b.v) }; }
+    friend SimdInt operator&(SimdInt a, SimdInt b) { return { _mm512_and_si512(a.v, b.v) }; }
+    SimdInt shiftedLeft(int bits) const { return { _mm512_sll_epi32(v, _mm_cvtsi32_si128(bits)) }; }
+};
+
+struct SimdFloat
+{
+    static constexpr int width = 16;
+    __m512 v;
+
+    static SimdFloat broadcast(float x) { return { _mm512_set1_ps(x) }; }
+    static SimdFloat load(const float* p) { return { _mm512_loadu_ps(p) }; }
+    void store(float* p) const { _mm512_storeu_ps(p, v); }
+    static SimdFloat gather(const float* base, SimdInt idx) { return { _mm512_i32gather_ps(idx.v, base, 4) }; }
+
+    static SimdFloat loadHalf(const std::uint16_t* p) { return { _mm512_cvtph_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p))) }; }
+    void storeHalf(std::uint16_t* p) const
+    {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), _mm512_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+    }
+    static SimdFloat gatherHalf(const std::uint16_t* base, SimdInt idx)
+    {
+        const __m512i words = _mm512_i32gather_epi32(idx.v, base, 2);
+        return { _mm512_cvtph_ps(_mm512_cvtepi32_epi16(words)) };
+    }
+
+    static SimdFloat loadInt16(const std::int16_t* p)
+    {
+        const __m512i i = _mm512_cvtepi16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)));
+        return { _mm512_mul_ps(_mm512_cvtepi32_ps(i), _mm512_set1_ps(1.0f / 32767.0f)) };
+    }
+    void storeInt16(std::int16_t* p) const
+    {
+        const __m512 scaled = _mm512_min_ps(_mm512_max_ps(_mm512_mul_ps(v, _mm512_set1_ps(32767.0f)), _mm512_set1_ps(-32767.0f)),
+                                            _mm512_set1_ps(32767.0f));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), _mm512_cvtsepi32_epi16(_mm512_cvtps_epi32(scaled)));
+    }
+    static SimdFloat gatherInt16(const std::int16_t* base, SimdInt idx)
+    {
+        const __m512i words = _mm512_i32gather_epi32(idx.v, base, 2);
+        const __m512i i = _mm512_srai_epi32(_mm512_slli_epi32(words, 16), 16);
+        return { _mm512_mul_ps(_mm512_cvtepi32_ps(i), _mm512_set1_ps(1.0f / 32767.0f)) };
+    }
+
+    friend SimdFloat operator+(SimdFloat a, SimdFloat b) { return { _mm512_add_ps(a.v, b.v) }; }
+    friend SimdFloat operator-(SimdFloat a, SimdFloat b) { return { _mm512_sub_ps(a.v, b.v) }; }
+    friend SimdFloat operator*(SimdFloat a, SimdFloat b) { return { _mm512_mul_ps(a.v, b.v) }; }
+    friend SimdFloat operator/(SimdFloat a, SimdFloat b) { return { _mm512_div_ps(a.v, b.v) }; }
+    friend SimdFloat min(SimdFloat a, SimdFloat b) { return { _mm512_min_ps(a.v, b.v) }; }
+    friend SimdFloat max(SimdFloat a, SimdFloat b) { return { _mm512_max_ps(a.v, b.v) }; }
+    friend SimdFloat abs(SimdFloat a) { return { _mm512_castsi512_ps(_mm512_and_si512(_mm512_castps_si512(a.v), _mm512_set1_epi32(0x7fffffff))) }; }
+    // Magnitude of `mag` with the sign of `sign`
+    friend SimdFloat copysign(SimdFloat mag, SimdFloat sign)
+    {
+        const __m512i signBit = _mm512_set1_epi32(static_cast<int>(0x80000000u));
+        return { _mm512_castsi512_ps(_mm512_or_si512(_mm512_andnot_si512(signBit, _mm512_castps_si512(mag.v)),
+                                                     _mm512_and_si512(signBit, _mm512_castps_si512(sign.v)))) };
+    }
+    SimdInt truncated() const { return { _mm512_cvttps_epi32(v) }; }
+    static SimdFloat fromInt(SimdInt i) { return { _mm512_cvtepi32_ps(i.v) }; }
+
+    float reduceMax() const
+    {
+        float lanes[width];
+        store(lanes);
+        float result = lanes[0];
+        for (int i = 1; i < width; ++i)
+            result = lanes[i] > result ? lanes[i] : result;
+        return result;
+    }
+
+    float reduceSum() const
+    {
+        float lanes[width];
+        store(lanes);
+        float result = lanes[0];
+        for (int i = 1; i < width; ++i)
+            result += lanes[i];
+        return result;
+    }
+};
+
+} // namespace simd_avx512
+
+#elif defined(__AVX2__)
+
+inline namespace simd_avx2
+{
+
+struct SimdInt
+{
+    static constexpr int width = 8;
+    __m256i v;
+
+    static SimdInt broadcast(int x) { return { _mm256_set1_epi32(x) }; }
+    static SimdInt iota() { return { _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7) }; }
+    static SimdInt load(const std::int32_t* p) { return { _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)) }; }
+    friend SimdInt operator+(SimdInt a, SimdInt b) { return { _mm256_add_epi32(a.v, b.v) }; }
+    friend SimdInt operator-(SimdInt a, SimdInt b) { return { _mm256_sub_epi32(a.v, b.v) }; }
+    friend SimdInt operator&(SimdInt a, SimdInt b) { return { _mm256_and_si256(a.v, b.v) }; }
+    SimdInt shiftedLeft(int bits) const { return { _mm256_sll_epi32(v, _mm_cvtsi32_si128(bits)) }; }
+};
+
+struct SimdFloat
+{
+    static constexpr int width = 8;
+    __m256 v;
+
+    static SimdFloat broadcast(float x) { return { _mm256_set1_ps(x) }; }
+    static SimdFloat load(const float* p) { return { _mm256_loadu_ps(p) }; }
+    void store(float* p) const { _mm256_storeu_ps(p, v); }
+    static SimdFloat gather(const float* base, SimdInt idx) { return { _mm256_i32gather_ps(base, idx.v, 4) }; }
+
+    static SimdFloat loadHalf(const std::uint16_t* p) { return { _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))) }; }
+    void storeHalf(std::uint16_t* p) const
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p), _mm256_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC));
+    }
+    static SimdFloat gatherHalf(const std::uint16_t* base, SimdInt idx)
+    {
+        return { _mm256_cvtph_ps(packWords(_mm256_i32gather_epi32(reinterpret_cast<const int*>(base), idx.v, 2))) };
+    }
+
+    static SimdFloat loadInt16(const std::int16_t* p)
+    {
+        const __m256i i = _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+        return { _mm256_mul_ps(_mm256_cvtepi32_ps(i), _mm256_set1_ps(1.0f / 32767.0f)) };
+    }
+    void storeInt16(std::int16_t* p) const
+    {
+        const __m256 scaled = _mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(v, _mm256_set1_ps(32767.0f)), _mm256_set1_ps(-32767.0f)),
+                                            _mm256_set1_ps(32767.0f));
+        const __m256i i = _mm256_cvtps_epi32(scaled);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p), _mm_packs_epi32(_mm256_castsi256_si128(i), _mm256_extracti128_si256(i, 1)));
+    }
+    static SimdFloat gatherInt16(const std::int16_t* base, SimdInt idx)
+    {
+        const __m256i words = _mm256_i32gather_epi32(reinterpret_cast<const int*>(base), idx.v, 2);
+        const __m256i i = _mm256_srai_epi32(_mm256_slli_epi32(words, 16), 16);
+        return { _mm256_mul_ps(_mm256_cvtepi32_ps(i), _mm256_set1_ps(1.0f / 32767.0f)) };
+    }
+
+    friend SimdFloat operator+(SimdFloat a, SimdFloat b) { return { _mm256_add_ps(a.v, b.v) }; }
+    friend SimdFloat operator-(SimdFloat a, SimdFloat b) { return { _mm256_sub_ps(a.v, b.v) }; }
+    friend SimdFloat operator*(SimdFloat a, SimdFloat b) { return { _mm256_mul_ps(a.v, b.v) }; }
+    friend SimdFloat operator/(SimdFloat a, SimdFloat b) { return { _mm256_div_ps(a.v, b.v) }; }
+    friend SimdFloat min(SimdFloat a, SimdFloat b) { return { _mm256_min_ps(a.v, b.v) }; }
+    friend SimdFloat max(SimdFloat a, SimdFloat b) { return { _mm256_max_ps(a.v, b.v) }; }
+    friend SimdFloat abs(SimdFloat a) { return { _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a.v) }; }
+    // Magnitude of `mag` with the sign of `sign`
+    friend SimdFloat copysign(SimdFloat mag, SimdFloat sign)
+    {
+        const __m256 signBit = _mm256_set1_ps(-0.0f);
+        return { _mm256_or_ps(_mm256_andnot_ps(signBit, mag.v), _mm256_and_ps(signBit, sign.v)) };
+    }
+    SimdInt truncated() const { return { _mm256_cvttps_epi32(v) }; }
+    static SimdFloat fromInt(SimdInt i) { return { _mm256_cvtepi32_ps(i.v) }; }
+
+    float reduceMax() const
+    {
+        float lanes[width];
+        store(lanes);
+        float result = lanes[0];
+        for (int i = 1; i < width; ++i)
+            result = lanes[i] > result ? lanes[i] : result;
+        return result;
+    }
+
+    float reduceSum() const
+    {
+        float lanes[width];
+        store(lanes);
+        float result = lanes[0];
+        for (int i = 1; i < width; ++i)
+            result += lanes[i];
+        return result;
+    }
+
+private:
+    // Low 16 bits of each 32-bit lane -> eight packed words
+    static __m128i packWords(__m256i words)
+    {
+        const __m256i i = _mm256_srai_epi32(_mm256_slli_epi32(words, 16), 16);   // sign-extend so packs is exact
+        return _mm_packs_epi32(_mm256_castsi256_si128(i), _mm256_extracti128_si256(i, 1));
+    }
+};
+
+} // namespace simd_avx2
+
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+
+inline namespace simd_sse2
+{
+
+struct SimdInt
+{
+    static constexpr int width = 4;
+    __m128i v;
+
+    static SimdInt broadcast(int x) { return { _mm_set1_epi32(x) }; }
+    static SimdInt iota() { return { _mm_setr_epi32(0, 1, 2, 3) }; }
+    static SimdInt load(const std::int32_t* p) { return { _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)) }; }
+    friend SimdInt operator+(SimdInt a, SimdInt b) { return { _mm_add_epi32(a.v, b.v) }; }
+    friend SimdInt operator-(SimdInt a, SimdInt b) { return { _mm_sub_epi32(a.v, b.v) }; }
+    friend SimdInt operator&(SimdInt a, SimdInt b) { return { _mm_and_si128(a.v, b.v) }; }
+    SimdInt shiftedLeft(int bits) const { return { _mm_sll_epi32(v, _mm_cvtsi32_si128(bits)) }; }
+};
+
+struct SimdFloat
+{
+    static constexpr int width = 4;
+    __m128 v;
+
+    static SimdFloat broadcast(float x) { return { _mm_set1_ps(x) }; }
+    static SimdFloat load(const float* p) { return { _mm_loadu_ps(p) }; }
+    void store(float* p) const { _mm_storeu_ps(p, v); }
+
+    // No gather instruction before AVX2: four scalar loads
+    static SimdFloat gather(const float* base, SimdInt idx)
+    {
+        alignas(16) std::int32_t i[4];
+        _mm_store_si128(reinterpret_cast<__m128i*>(i), idx.v);
+        return { _mm_setr_ps(base[i[0]], base[i[1]], base[i[2]], base[i[3]]) };
+    }
+
+    // No F16C: half <-> float with integer bit operations (as SampleCodec)
+    static SimdFloat loadHalf(const std::uint16_t* p)
+    {
+        const __m128i words = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(p));
+        return fromHalfBits(_mm_unpacklo_epi16(words, _mm_setzero_si128()));
+    }
+    void storeHalf(std::uint16_t* p) const
+    {
+        const __m128i bits = _mm_srai_epi32(_mm_slli_epi32(toHalfBits(v), 16), 16);   // sign-extend so packs is exact
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(p), _mm_packs_epi32(bits, bits));
+    }
+    static SimdFloat gatherHalf(const std::uint16_t* base, SimdInt idx)
+    {
+        alignas(16) std::int32_t i[4];
+        _mm_store_si128(reinterpret_cast<__m128i*>(i), idx.v);
+        return fromHalfBits(_mm_setr_epi32(base[i[0]], base[i[1]], base[i[2]], base[i[3]]));
+    }
+
+    static SimdFloat loadInt16(const std::int16_t* p)
+    {
+        const __m128i words = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(p));
+        return fromInt16(_mm_srai_epi32(_mm_unpacklo_epi16(words, words), 16));
+    }
+    void storeInt16(std::int16_t* p) const
+    {
+        const __m128 scaled = _mm_min_ps(_mm_max_ps(_mm_mul_ps(v, _mm_set1_ps(32767.0f)), _mm_set1_ps(-32767.0f)), _mm_set1_ps(32767.0f));
+        const __m128i i = _mm_cvtps_epi32(scaled);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(p), _mm_packs_epi32(i, i));
+    }
+    static SimdFloat gatherInt16(const std::int16_t* base, SimdInt idx)
+    {
+        alignas(16) std::int32_t i[4];
+        _mm_store_si128(reinterpret_cast<__m128i*>(i), idx.v);
+        return fromInt16(_mm_setr_epi32(base[i[0]], base[i[1]], base[i[2]], base[i[3]]));
+    }
+
+    friend SimdFloat operator+(SimdFloat a, SimdFloat b) { return { _mm_add_ps(a.v, b.v) }; }
+    friend SimdFloat operator-(SimdFloat a, SimdFloat b) { return { _mm_sub_ps(a.v, b.v) }; }
+    friend SimdFloat operator*(SimdFloat a, SimdFloat b) { return { _mm_mul_ps(a.v, b.v) }; }
+    friend SimdFloat operator/(SimdFloat a, SimdFloat b) { return { _mm_div_ps(a.v, b.v) }; }
+    friend SimdFloat min(SimdFloat a, SimdFloat b) { return { _mm_min_ps(a.v, b.v) }; }
+    friend SimdFloat max(SimdFloat a, SimdFloat b) { return { _mm_max_ps(a.v, b.v) }; }
+    friend SimdFloat abs(SimdFloat a) { return { _mm_andnot_ps(_mm_set1_ps(-0.0f), a.v) }; }
+    // Magnitude of `mag` with the sign of `sign`
+    friend SimdFloat copysign(SimdFloat mag, SimdFloat sign)
+    {
+        const __m128 signBit = _mm_set1_ps(-0.0f);
+        return { _mm_or_ps(_mm_andnot_ps(signBit, mag.v), _mm_and_ps(signBit, sign.v)) };
+    }
+    SimdInt truncated() const { return { _mm_cvttps_epi32(v) }; }
+    static SimdFloat fromInt(SimdInt i) { return { _mm_cvtepi32_ps(i.v) }; }
+
+    float reduceMax() const
+    {
+        float lanes[width];
+        store(lanes);
+        float result = lanes[0];
+        for (int i = 1; i < width; ++i)
+            result = lanes[i] > result ? lanes[i] : result;
+        return result;
+    }
+
+    float reduceSum() const
+    {
+        float lanes[width];
+        store(lanes);
+        float result = lanes[0];
+        for (int i = 1; i < width; ++i)
+            result += lanes[i];
+        return result;
+    }
+
+private:
+    static SimdFloat fromInt16(__m128i i) { return { _mm_mul_ps(_mm_cvtepi32_ps(i), _mm_set1_ps(1.0f / 32767.0f)) }; }
+
+    // Halves in the low 16 bits of each lane
+    static SimdFloat fromHalfBits(__m128i h)
+    {
+        __m128i u = _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x7fff)), 13);
+        const __m128i isSubnormal = _mm_cmpeq_epi32(_mm_and_si128(u, _mm_set1_epi32(0x7c00 << 13)), _mm_setzero_si128());
+        u = _mm_add_epi32(u, _mm_set1_epi32((127 - 15) << 23));
+        const __m128 subnormal = _mm_sub_ps(_mm_castsi128_ps(_mm_add_epi32(u, _mm_set1_epi32(1 << 23))), _mm_set1_ps(6.103515625e-05f));
+        const __m128 magnitude = _mm_or_ps(_mm_and_ps(_mm_castsi128_ps(isSubnormal), subnormal),
+                                           _mm_andnot_ps(_mm_castsi128_ps(isSubnormal), _mm_castsi128_ps(u)));
+        const __m128i sign = _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x8000)), 16);
+        return { _mm_or_ps(magnitude, _mm_castsi128_ps(sign)) };
+    }
+
+    // Half bit patterns in the low 16 bits of each lane, rounded to nearest even
+    static __m128i toHalfBits(__m128 x)
+    {
+        const __m128i signBit = _mm_set1_epi32(static_cast<int>(0x80000000u));
+        const __m128i denormMagic = _mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23);
+        const __m128i sign = _mm_and_si128(_mm_castps_si128(x), signBit);
+
+        // |x| clamped to the largest half (NaN takes the second operand: also the maximum)
+        const __m128 magnitude = _mm_min_ps(_mm_andnot_ps(_mm_castsi128_ps(signBit), x), _mm_set1_ps(65504.0f));
+        const __m128i u = _mm_castps_si128(magnitude);
+
+        const __m128i isSubnormal = _mm_cmplt_epi32(u, _mm_set1_epi32(113 << 23));
+        const __m128i subnormal = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(magnitude, _mm_castsi128_ps(denormMagic))), denormMagic);
+        const __m128i mantissaOdd = _mm_and_si128(_mm_srli_epi32(u, 13), _mm_set1_epi32(1));
+        const __m128i rebias = _mm_set1_epi32(static_cast<int>(((15u - 127u) << 23) + 0xfffu));
+        const __m128i normal = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(u, rebias), mantissaOdd), 13);
+
+        const __m128i bits = _mm_or_si128(_mm_and_si128(isSubnormal, subnormal), _mm_andnot_si128(isSubnormal, normal));
+        return _mm_or_si128(bits, _mm_srli_epi32(sign, 16));
+    }
+};
+
+} // namespace simd_sse2
+
+#else
+
+inline namespace simd_scalar
+{
+
+struct SimdInt
+{
+    static constexpr int width = 1;
+    std::int32_t v;
+
+    static SimdInt broadcast(int x) { return { x }; }
+    static SimdInt iota() { return { 0 }; }
+    static SimdInt load(const std::int32_t* p) { return { p[0] }; }
+    friend SimdInt operator+(SimdInt a, SimdInt b) { return { a.v + b.v }; }
+    friend SimdInt operator-(SimdInt a, SimdInt b) { return { a.v - b.v }; }
+    friend SimdInt operator&(SimdInt a, SimdInt b) { return { a.v & b.v }; }
+    SimdInt shiftedLeft(int bits) const { return { v << bits }; }
+};
+
+struct SimdFloat
+{
+    static constexpr int width = 1;
+    float v;
+
+    static SimdFloat broadcast(float x) { return { x }; }
+    static SimdFloat load(const float* p) { return { *p }; }
+    void store(float* p) const { *p = v; }
+    static SimdFloat gather(const float* base, SimdInt idx) { return { base[idx.v] }; }
+
+    static SimdFloat loadHalf(const std::uint16_t* p) { return { SampleCodec::halfToFloat(*p) }; }
+    void storeHalf(std::uint16_t* p) const { *p = SampleCodec::floatToHalf(v); }
+    static SimdFloat gatherHalf(const std::uint16_t* base, SimdInt idx) { return { SampleCodec::halfToFloat(base[idx.v]) }; }
+
+    static SimdFloat loadInt16(const std::int16_t* p) { return { SampleCodec::int16ToFloat(*p) }; }
+    void storeInt16(std::int16_t* p) const { *p = SampleCodec::floatToInt16(v); }
+    static SimdFloat gatherInt16(const std::int16_t* base, SimdInt idx) { return { SampleCodec::int16ToFloat(base[idx.v]) }; }
+
+    friend SimdFloat operator+(SimdFloat a, SimdFloat b) { return { a.v + b.v }; }
+    friend SimdFloat operator-(SimdFloat a, SimdFloat b) { return { a.v - b.v }; }
+    friend SimdFloat operator*(SimdFloat a, SimdFloat b) { return { a.v * b.v }; }
+    friend SimdFloat operator/(SimdFloat a, SimdFloat b) { return { a.v / b.v }; }
+    friend SimdFloat min(SimdFloat a, SimdFloat b) { return { a.v < b.v ? a.v : b.v }; }
+    friend SimdFloat max(SimdFloat a, SimdFloat b) { return { a.v > b.v ? a.v : b.v }; }
+    friend SimdFloat abs(SimdFloat a) { return { std::abs(a.v) }; }
+    friend SimdFloat copysign(SimdFloat mag, SimdFloat sign) { return { std::copysign(mag.v, sign.v) }; }
+    SimdInt truncated() const { return { static_cast<std::int32_t>(v) }; }
+    static SimdFloat fromInt(SimdInt i) { return { static_cast<float>(i.v) }; }
+
+    float reduceMax() const
+    {
+        float lanes[width];
+        store(lanes);
+        float result = lanes[0];
+        for (int i = 1; i < width; ++i)
+            result = lanes[i] > result ? lanes[i] : result;
+        return result;
+    }
+
+    float reduceSum() const
+    {
+        float lanes[width];
+        store(lanes);
+        float result = lanes[0];
+        for (int i = 1; i < width; ++i)
+            result += lanes[i];
+        return result;
+    }
+};
+
+} // namespace simd_scalar
+
+#endif
@@ -0,0 +1,490 @@
+#pragma once
+
+#include "CinderEngine.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <type_traits>
+#include <vector>
+
+/**
+ * SpilloverEngine - CinderEngine with tail spillover across big parameter jumps
+ *
+ * Two engines, both allocated in prepare() when spillover is on (neither
+ * allocates anything before that), plus a 4-line one in the 8-line build
+ * for the cheapest quality level. One is live: it gets the input
+ * and the current parameters. When a preset is recalled (requestSpillover)
+ * or a block's targets jump far on a parameter that shapes the tail (DECAY,
+ * SHIMMER, BURN, SIZE, band decays), the other engine takes over as live,
+ * starting clean at the new settings. The previous one keeps ringing with
+ * its old settings and no new input, and its output is added to the live one.
+ *
+ * The outgoing engine is retired (and cleared) as soon as its output drops
+ * below -90 dBFS. An infinite or frozen tail is released to a 1s decay after
+ * 8s. At most two engines ever run: a jump during a spillover is smoothed
+ * like any parameter change instead of starting a third, and a change of
+ * engine size waits for the tail to retire.
+ *
+ * Same interface as BasicCinderEngine (parameters, process, processChannel),
+ * so it drops in where a host-facing engine is needed. Spillover starts
+ * disabled: then only the live engine runs and the output is identical to a
+ * single BasicCinderEngine's.
+ *
+ * Quality levels (setQualityLevel, for a host under CPU pressure - see
+ * QualityGovernor), least audible first, each keeping the cuts of the ones
+ * above it:
+ *   0  full
+ *   1  fast BURN: the Pade tanh on all lines at once (within 1e-4)
+ *   2  no spillover: jumps are smoothed in place, and a tail already
+ *      spilling is released to a 0.25s decay so it retires (up to half the cost)
+ *   3  no MOD: the line modulation fades out over 250ms and the lines go static
+ *   4  FDN4 (8-line build only): a 4-line engine takes the input, and the
+ *      8-line tail rings out over 0.25s as a spilled tail would. Back above
+ *      this level, the 8-line engine takes over the same way.
+ * Levels 1-3 only save time while BURN, a spillover or MOD is in use, and
+ * cut nothing from the sound. Level 4 roughly halves the cost at any setting,
+ * at the price of a sparser tail. Level 0 is bit-identical to running
+ * without levels.
+ */
+template <int fdnOrder>
+class BasicSpilloverEngine
+{
+public:
+    using Engine = BasicCinderEngine<fdnOrder>;
+    using Meters = typename Engine::Meters;
+
+    // The 8-line build sheds down to a 4-line engine at its cheapest level
+    static constexpr bool hasReducedEngine = fdnOrder > 4;
+
+    static constexpr int numParams = Engine::numParams;
+    static constexpr int numChannelTasks = Engine::numChannelTasks;
+    static constexpr auto paramRanges = Engine::paramRanges;
+
+    BasicSpilloverEngine()
+    {
+        for (int i = 0; i < numParams; ++i)
+            targets[static_cast<size_t>(i)].store(Engine::paramRanges[static_cast<size_t>(i)].defaultValue);
+    }
+
+    // Allocates the second engine only if spillover is enabled (and the
+    // 4-line one in the 8-line build, for the cheapest quality level). As with
+    // BasicCinderEngine, preparing again at the same rate keeps the tails,
+    // a spillover in progress included.
+    void prepare(double sampleRate, int maxBlockSize)
+    {
+        const bool wasPoolReady = poolReady;
+        const bool rateChanged = ! engines[0].isPrepared() || sampleRate != preparedRate;
+
+        poolReady = spilloverEnabled.load(std::memory_order_relaxed);
+        const bool restart = rateChanged || poolReady != wasPoolReady;
+
+        // A tail that keeps spilling keeps its own settings
+        forEachPrepared([&](int slot, auto& engine) {
+            if (restart || ! spilling || slot != tail)
+                pushTargets(engine);
+            engine.prepare(sampleRate, maxBlockSize);
+        });
+
+        maxBlock = std::max(1, maxBlockSize);
+        for (auto& buffer : tailBuffers)
+            if (buffer.size() != static_cast<size_t>(maxBlock))
+                buffer.assign(static_cast<size_t>(maxBlock), 0.0f);
+
+        maxSpillSamples = static_cast<int>(maxSpillSeconds * sampleRate);
+        preparedRate = sampleRate;
+
+        // A new rate has cleared the engines; a pool that was switched on or
+        // off starts over from clean engines too, with engine 0 live
+        if (restart)
+        {
+            if (! rateChanged)
+                forEachPrepared([](int, auto& engine) { engine.reset(); });
+            live = lastFull = 0;
+            spilling = false;
+        }
+        currentSlot = live;
+        lastTargets = readTargets();
+    }
+
+    // Frees every engine's memory until the next prepare()
+    void release()
+    {
+        forEachEngine([](auto& engine) { engine.release(); });
+        for (auto& buffer : tailBuffers)
+            buffer = std::vector<float>();
+        poolReady = false;
+        spilling = false;
+    }
+
+    bool isPrepared() const { return engines[0].isPrepared(); }
+
+    // Clears every tail and ends any spillover
+    void reset()
+    {
+        forEachPrepared([this](int, auto& engine) {
+            pushTargets(engine);
+            engine.reset();
+        });
+        spilling = false;
+        lastTargets = readTargets();
+    }
+
+    // Safe from any thread; takes effect at the next process() call
+    void setParameter(int index, float value)
+    {
+        if (index < 0 || index >= numParams || std::isnan(value))
+            return;
+
+        const auto& range = Engine::paramRanges[static_cast<size_t>(index)];
+        targets[static_cast<size_t>(index)].store(std::clamp(value, range.minValue, range.maxValue),
+                                                  std::memory_order_relaxed);
+    }
+
+    float getParameter(int index) const
+    {
+        return (index >= 0 && index < numParams) ? targets[static_cast<size_t>(index)].load(std::memory_order_relaxed)
+                                                 : 0.0f;
+    }
+
+    // Any thread. Off (the default): big jumps are smoothed in place, as in
+    // BasicCinderEngine. Turning it on takes effect at the next prepare().
+    void setSpilloverEnabled(bool enabled) { spilloverEnabled.store(enabled, std::memory_order_relaxed); }
+
+    // Any thread: hand over to a fresh engine at the next block (e.g. on preset recall)
+    void requestSpillover() { spilloverRequested.store(true, std::memory_order_relaxed); }
+
+    bool isSpilling() const { return spilling; }
+
+    // As BasicCinderEngine::setSnapshot / clearSnapshots / hasSnapshot; all
+    // engines morph between the same pair
+    static constexpr int numSnapshots = Engine::numSnapshots;
+
+    void setSnapshot(int slot, const float* values)
+    {
+        forEachEngine([&](auto& engine) { engine.setSnapshot(slot, values); });
+    }
+
+    void clearSnapshots()
+    {
+        forEachEngine([](auto& engine) { engine.clearSnapshots(); });
+    }
+
+    bool hasSnapshot(int slot) const { return engines[0].hasSnapshot(slot); }
+
+    int getRecoveryCount() const
+    {
+        int count = engines[0].getRecoveryCount() + engines[1].getRecoveryCount();
+        if constexpr (hasReducedEngine)
+            count += reduced.getRecoveryCount();
+        return count;
+    }
+
+    // As BasicCinderEngine::setDelayInterpolation / setInputDiffusion / setDelayStorage, for every engine
+    void setDelayInterpolation(DelayBuffer::Interpolation interpolation)
+    {
+        forEachEngine([=](auto& engine) { engine.setDelayInterpolation(interpolation); });
+    }
+
+    void setInputDiffusion(typename BasicShimmerReverb<fdnOrder>::InputDiffusion diffusion)
+    {
+        for (auto& engine : engines)
+            engine.setInputDiffusion(diffusion);
+        if constexpr (hasReducedEngine)
+            reduced.setInputDiffusion(static_cast<typename BasicShimmerReverb<4>::InputDiffusion>(diffusion));
+    }
+
+    void setDelayStorage(SampleStorage storage)
+    {
+        forEachEngine([=](auto& engine) { engine.setDelayStorage(storage); });
+    }
+
+    static constexpr int numQualityLevels = hasReducedEngine ? 5 : 4;
+
+    // Any thread; takes effect at the next process() call
+    void setQualityLevel(int level)
+    {
+        requestedQuality.store(std::clamp(level, 0, numQualityLevels - 1), std::memory_order_relaxed);
+    }
+
+    int getQualityLevel() const { return requestedQuality.load(std::memory_order_relaxed); }
+
+    // In-place stereo processing. `left` and `right` may alias (mono).
+    Meters process(float* left, float* right, int numSamples)
+    {
+        return process(left, right, numSamples, [this] {
+            for (int channel = 0; channel < numChannelTasks; ++channel)
+                processChannel(channel);
+        });
+    }
+
+    // As BasicCinderEngine::process(..., runChannels); runChannels may be
+    // called twice per chunk while a tail is spilling over
+    template <typename RunChannels>
+    Meters process(float* left, float* right, int numSamples, RunChannels&& runChannels)
+    {
+        const int level = requestedQuality.load(std::memory_order_relaxed);
+        if (level != quality)
+        {
+            quality = level;
+            applyQuality();
+        }
+        updateEngineSize();
+        updateTargets();
+
+        currentSlot = live;
+        Meters meters = withSlot(live, [&](auto& engine) {
+            return toMeters(engine.process(left, right, numSamples, runChannels));
+        });
+
+        if (spilling)
+            withSlot(tail, [&](auto& outgoing) { processTail(outgoing, left, right, numSamples, runChannels, meters); });
+
+        return meters;
+    }
+
+    // Runs one channel's reverb of the engine being processed (see process)
+    void processChannel(int channel)
+    {
+        withSlot(currentSlot, [channel](auto& engine) { engine.processChannel(channel); });
+    }
+
+private:
+    static constexpr float jumpThreshold = 0.25f;        // fraction of a parameter's range, within one block
+    static constexpr float retireLevel = 3.16e-5f;       // -90 dBFS output RMS
+    static constexpr double maxSpillSeconds = 8.0;
+    static constexpr float releaseDecay = 1.0f;          // seconds, for tails that would never retire
+    static constexpr float shedDecay = 0.25f;            // seconds, for a tail dropped at quality level 2+
+    static constexpr int reducedLevel = 4;               // quality level that runs the 4-line engine
+
+    // Parameters whose jumps reshape a running tail
+    static constexpr std::array<int, 6> tailParams { Engine::decay, Engine::shimmer, Engine::burn, Engine::size,
+                                                     Engine::lowDecay, Engine::highDecay };
+
+    // Engine slots: 0 and 1 are the pair, reducedSlot the 4-line engine
+    static constexpr int reducedSlot = 2;
+    struct NoEngine {};
+    using ReducedEngine = std::conditional_t<hasReducedEngine, BasicCinderEngine<4>, NoEngine>;
+
+    std::array<Engine, 2> engines;
+    ReducedEngine reduced;
+    int live = 0;
+    int lastFull = 0;         // the pair's engine to hand back to from the reduced one
+    int tail = 0;             // outgoing engine while spilling
+    int currentSlot = 0;      // engine being processed (for processChannel)
+    bool poolReady = false;   // second engine prepared
+    double preparedRate = 0.0;
+    bool spilling = false;
+    int spillSamples = 0;
+    int maxSpillSamples = 0;
+
+    std::array<std::atomic<float>, numParams> targets;
+    std::array<float, numParams> lastTargets {};
+    std::atomic<bool> spilloverEnabled { false };
+    std::atomic<bool> spilloverRequested { false };
+
+    // Quality level: requested (any thread) and applied (audio thread)
+    std::atomic<int> requestedQuality { 0 };
+    int quality = 0;
+
+    // Silent input for the outgoing engine, then its output
+    int maxBlock = 1;
+    std::array<std::vector<float>, 2> tailBuffers;
+
+    std::array<float, numParams> readTargets() const
+    {
+        std::array<float, numParams> values;
+        for (int i = 0; i < numParams; ++i)
+            values[static_cast<size_t>(i)] = targets[static_cast<size_t>(i)].load(std::memory_order_relaxed);
+        return values;
+    }
+
+    // Calls f with the engine in `slot`; its result is f's
+    template <typename F>
+    decltype(auto) withSlot(int slot, F&& f)
+    {
+        if constexpr (hasReducedEngine)
+            if (slot == reducedSlot)
+                return f(reduced);
+        return f(engines[static_cast<size_t>(slot)]);
+    }
+
+    // Every engine, prepared or not
+    template <typename F>
+    void forEachEngine(F&& f)
+    {
+        for (auto& engine : engines)
+            f(engine);
+        if constexpr (hasReducedEngine)
+            f(reduced);
+    }
+
+    // The engines prepare() allocates, with their slots: the pair's first
+    // (and second, if spillover is on) and the reduced one
+    template <typename F>
+    void forEachPrepared(F&& f)
+    {
+        for (int e = 0; e < (poolReady ? 2 : 1); ++e)
+            f(e, engines[static_cast<size_t>(e)]);
+        if constexpr (hasReducedEngine)
+            f(reducedSlot, reduced);
+    }
+
+    // The two engine sizes have the same meters under different types
+    template <typename EngineMeters>
+    static Meters toMeters(const EngineMeters& meters)
+    {
+        return { meters.reverbPeak, meters.outputRms, meters.outputPeak };
+    }
+
+    template <typename AnyEngine>
+    void pushTargets(AnyEngine& engine, const std::array<float, numParams>& values)
+    {
+        for (int i = 0; i < numParams; ++i)
+            engine.setParameter(i, values[static_cast<size_t>(i)]);
+    }
+
+    template <typename AnyEngine>
+    void pushTargets(AnyEngine& engine) { pushTargets(engine, readTargets()); }
+
+    bool isJump(const std::array<float, numParams>& values) const
+    {
+        for (const int index : tailParams)
+        {
+            const auto& range = Engine::paramRanges[static_cast<size_t>(index)];
+            const float change = std::abs(values[static_cast<size_t>(index)] - lastTargets[static_cast<size_t>(index)]);
+            if (change > jumpThreshold * (range.maxValue - range.minValue))
+                return true;
+        }
+        return false;
+    }
+
+    // The engines' settings for the applied quality level
+    void applyQuality()
+    {
+        forEachEngine([this](auto& engine) {
+            engine.setFastBurn(quality >= 1);
+            engine.setModulationEnabled(quality < 3);
+        });
+    }
+
+    // Block start: at reducedLevel the 4-line engine takes the input from the
+    // pair's live one, and hands it back above that level. The outgoing
+    // engine rings out as a spilled tail, so neither swap starts while
+    // another tail is still spilling.
+    void updateEngineSize()
+    {
+        if constexpr (hasReducedEngine)
+        {
+            const bool reduce = quality >= reducedLevel;
+            if (reduce == (live == reducedSlot) || spilling)
+                return;
+
+            const auto values = readTargets();
+            withSlot(live, [this](auto& outgoing) { pushTargets(outgoing, lastTargets); });
+
+            tail = live;
+            if (reduce)
+                lastFull = live;
+            live = reduce ? reducedSlot : lastFull;
+
+            // The incoming engine is clean (prepared, or cleared when it retired)
+            withSlot(live, [&](auto& incoming) {
+                pushTargets(incoming, values);
+                incoming.snapParameters();
+            });
+
+            spilling = true;
+            spillSamples = 0;
+            lastTargets = values;
+        }
+    }
+
+    // Block start: hand over to the idle engine on a jump (or request), else
+    // pass the new targets to the live engine to smooth towards
+    void updateTargets()
+    {
+        const auto values = readTargets();
+        const bool requested = spilloverRequested.exchange(false, std::memory_order_relaxed);
+
+        if (poolReady && spilloverEnabled.load(std::memory_order_relaxed) && quality < 2 && ! spilling
+            && live != reducedSlot && (requested || isJump(values)))
+        {
+            // The outgoing engine keeps the settings it was running
+            auto& outgoing = engines[static_cast<size_t>(live)];
+            pushTargets(outgoing, lastTargets);
+
+            // The idle engine is clean (prepared, or cleared when it retired)
+            tail = live;
+            live = 1 - live;
+            auto& incoming = engines[static_cast<size_t>(live)];
+            pushTargets(incoming, values);
+            incoming.snapParameters();
+
+            spilling = true;
+            spillSamples = 0;
+        }
+        else
+        {
+            withSlot(live, [&](auto& engine) { pushTargets(engine, values); });
+        }
+
+        lastTargets = values;
+    }
+
+    // Runs the outgoing engine on silence and adds its tail to the output
+    template <typename TailEngine, typename RunChannels>
+    void processTail(TailEngine& outgoing, float* left, float* right, int numSamples, RunChannels& runChannels,
+                     Meters& meters)
+    {
+        currentSlot = tail;
+
+        if (spillSamples >= maxSpillSamples || quality >= 2)
+        {
+            // Infinite or frozen (or shed for CPU): let it decay so it can retire
+            const float release = quality >= 2 ? shedDecay : releaseDecay;
+            outgoing.setParameter(Engine::decay, std::min(outgoing.getParameter(Engine::decay), release));
+            outgoing.setParameter(Engine::freeze, 0.0f);
+        }
+
+        const bool mono = left == right;
+        float tailSquares = 0.0f;
+        float tailPeak = 0.0f;
+        for (int pos = 0; pos < numSamples; pos += maxBlock)
+        {
+            const int n = std::min(maxBlock, numSamples - pos);
+            float* tailL = tailBuffers[0].data();
+            float* tailR = tailBuffers[1].data();
+            std::fill(tailL, tailL + n, 0.0f);
+            std::fill(tailR, tailR + n, 0.0f);
+
+            const auto tailMeters = outgoing.process(tailL, tailR, n, runChannels);
+            tailSquares += tailMeters.outputRms * tailMeters.outputRms * static_cast<float>(n);
+            tailPeak = std::max(tailPeak, tailMeters.outputPeak);
+            meters.reverbPeak = std::max(meters.reverbPeak, tailMeters.reverbPeak);
+
+            // Mono (aliased) output carries the right channel, as in the engine
+            if (! mono)
+                for (int i = 0; i < n; ++i)
+                    left[pos + i] += tailL[i];
+            for (int i = 0; i < n; ++i)
+                right[pos + i] += tailR[i];
+        }
+
+        // Tail and new sound are uncorrelated: powers add; the peak is bounded by the sum
+        const float tailRms = numSamples > 0 ? std::sqrt(tailSquares / static_cast<float>(numSamples)) : 0.0f;
+        meters.outputRms = std::sqrt(meters.outputRms * meters.outputRms + tailRms * tailRms);
+        meters.outputPeak += tailPeak;
+
+        currentSlot = live;
+        spillSamples += numSamples;
+
+        if (numSamples > 0 && tailRms < retireLevel)
+        {
+            outgoing.reset();
+            spilling = false;
+        }
+    }
+};
+
+using SpilloverEngine = BasicSpilloverEngine<8>;
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "SimdFloat.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+/**
+ * VelvetDiffuser - Sparse velvet-noise FIR for input diffusion
+ *
+ * One +-1 tap per ~0.8 ms slot of the last 40 ms, at a pseudo-random
+ * position within its slot. The envelope (t^1.75 e^(-t / 6.8 ms)) and the
+ * total energy match the allpass chain's impulse response: energy centred
+ * at ~15 ms with a ~7 ms spread, and the same 6 dB gain, so switching keeps
+ * the smear and the wet level. Each sample is one write to a single ring
+ * buffer plus a sum of gathered taps (numTaps / SimdFloat::width gathers),
+ * with no feedback and no fractional delays - the alternative to
+ * ShimmerReverb's four serial allpasses.
+ *
+ * The tap pattern comes from a fixed seed, so every instance and every run
+ * sounds the same. All memory is allocated in prepare().
+ */
+class VelvetDiffuser
+{
+public:
+    static constexpr int numTaps = 48;
+    static constexpr float lengthSeconds = 0.04f;
+
+    static_assert(numTaps % SimdFloat::width == 0, "taps must fill whole registers");
+
+    void prepare(double sampleRate)
+    {
+        const int length = std::max(numTaps, static_cast<int>(lengthSeconds * sampleRate));
+
+        int size = 2;
+        while (size < length + 1)
+            size <<= 1;
+        buffer.assign(static_cast<size_t>(2 * size), 0.0f);
+        mask = size - 1;
+        writePos = 0;
+
+        // Velvet noise: position and sign per slot from a fixed LCG
+        std::uint32_t seed = 0x2545f491u;
+        auto nextRandom = [&seed] {
+            seed = seed * 1664525u + 1013904223u;
+            return static_cast<float>(seed >> 8) * (1.0f / 16777216.0f);   // 0..1
+        };
+
+        const float slot = static_cast<float>(length) / static_cast<float>(numTaps);
+        float energy = 0.0f;
+        for (int k = 0; k < numTaps; ++k)
+        {
+            const float position = static_cast<float>(k) * slot + nextRandom() * std::max(0.0f, slot - 1.0f);
+            offsets[static_cast<size_t>(k)] = -std::min(static_cast<std::int32_t>(position), static_cast<std::int32_t>(length - 1));
+
+            const float t = position / static_cast<float>(sampleRate) / envelopeSeconds;
+            const float envelope = std::pow(t, 1.75f) * std::exp(-t);
+            gains[static_cast<size_t>(k)] = nextRandom() < 0.5f ? -envelope : envelope;
+            energy += envelope * envelope;
+        }
+
+        for (auto& gain : gains)
+            gain *= std::sqrt(outputEnergy / energy);
+    }
+
+    void reset()
+    {
+        std::fill(buffer.begin(), buffer.end(), 0.0f);
+        writePos = 0;
+    }
+
+    // Frees the ring; prepare() again before processing
+    void release()
+    {
+        buffer = std::vector<float>();
+        mask = 1;
+        writePos = 0;
+    }
+
+    float process(float input)
+    {
+        // Mirrored ring: every sample is written twice, so the taps behind
+        // the second copy never wrap and are constant offsets from it
+        const auto size = static_cast<size_t>(mask + 1);
+        float* const newest = buffer.data() + size + static_cast<size_t>(writePos);
+        newest[0] = newest[-static_cast<std::ptrdiff_t>(size)] = input;
+
+        SimdFloat sum = SimdFloat::broadcast(0.0f);
+        for (int k = 0; k < numTaps; k += SimdFloat::width)
+            sum = sum + SimdFloat::gather(newest, SimdInt::load(&offsets[static_cast<size_t>(k)]))
+                            * SimdFloat::load(&gains[static_cast<size_t>(k)]);
+
+        writePos = (writePos + 1) & mask;
+        return sum.reduceSum();
+    }
+
+private:
+    static constexpr float envelopeSeconds = 0.0068f;
+    static constexpr float outputEnergy = 4.0f;   // the allpass chain's (+6 dB)
+
+    std::vector<float> buffer;
+    int mask = 1;
+    int writePos = 0;
+
+    // Tap positions relative to the newest sample (0, -d1, -d2, ...) and signed, normalised gains
+    alignas(64) std::array<std::int32_t, numTaps> offsets{};
+    alignas(64) std::array<float, numTaps> gains{};
+};
@@ -15,7 +15,7 @@ void CinderContentPanel::paint(juce::Graphics& g)
     // Header bar (36px)
     g.setFont(laf->getHeaderFont());
     g.setColour(juce::Colour(CinderLookAndFeel::colTextPrimary));
-    g.drawText("CINDER", pad, 8, 200, 22, juce::Justification::centredLeft);
+    g.drawText(CinderPluginConfig::displayName, pad, 8, 200, 22, juce::Justification::centredLeft);
 
     g.setFont(laf->getBrandFont());
     g.setColour(juce::Colour(CinderLookAndFeel::colTextDim));
@@ -50,21 +50,25 @@ void CinderContentPanel::paint(juce::Graphics& g)
 CinderEditor::CinderEditor(CinderProcessor& p)
     : AudioProcessorEditor(&p),
       processor(p),
-      waveformVisualizer(p.currentReverbLevel,
-                         *p.apvts.getRawParameterValue("decay"),
-                         *p.apvts.getRawParameterValue("burn")),
-      outputMeter(p.outputRmsLevel, p.outputPeakLevel)
+      qualityIndicator(p.processLoad, p.qualityLevel, CinderProcessor::numQualityLevels)
 {
     setLookAndFeel(&cinderLook);
     contentPanel.laf = &cinderLook;
 
     addAndMakeVisible(contentPanel);
 
-    // Visualizer
-    contentPanel.addAndMakeVisible(waveformVisualizer);
-
-    // Output meter
-    contentPanel.addAndMakeVisible(outputMeter);
+    if constexpr (animatedVisuals)
+    {
+        // Visualizer
+        waveformVisualizer = std::make_unique<WaveformVisualizer>(p.currentReverbLevel,
+                                                                  *p.apvts.getRawParameterValue("decay"),
+                                                                  *p.apvts.getRawParameterValue("burn"));
+        contentPanel.addAndMakeVisible(*waveformVisualizer);
+
+        // Output meter
+        outputMeter = std::make_unique<OutputMeter>(p.outputRmsLevel, p.outputPeakLevel);
+        contentPanel.addAndMakeVisible(*outputMeter);
+    }
 
     // Helpers
     auto addKnob = [this](CinderKnob& slider, juce::Label& label,
@@ -89,6 +93,8 @@ CinderEditor::CinderEditor(CinderProcessor& p)
     addKnob(duckKnob, duckLabel, "DUCK", "duck", duckAtt);
     addKnob(mixKnob,  mixLabel,  "MIX",  "mix",  mixAtt);
 
+    contentPanel.addAndMakeVisible(qualityIndicator);
+
     // Freeze toggle
     contentPanel.addAndMakeVisible(freezeButton);
     freezeButton.setButtonText("FREEZE");
@@ -137,7 +143,7 @@ void CinderEditor::resized()
     contentPanel.setTransform(juce::AffineTransform::scale(scale));
     contentPanel.setBounds(0, 0, designW, designH);
 
-    // --- All layout below at design dimensions (520 x 440) ---
+    // --- All layout below at design dimensions (520 x designH) ---
     const int pad = 16;
     const int labelH = 14;
     const int knobS = 55;
@@ -147,9 +153,15 @@ void CinderEditor::resized()
     freezeButton.setBounds(240, 6, 90, 24);
     y += 36;
 
+    // Footer, opposite the version
+    qualityIndicator.setBounds(designW - pad - 140, designH - 20, 140, 14);
+
     // Waveform Visualizer: 76px
-    waveformVisualizer.setBounds(pad, y, designW - pad * 2, 76);
-    y += 80;
+    if constexpr (animatedVisuals)
+    {
+        waveformVisualizer->setBounds(pad, y, designW - pad * 2, 76);
+        y += 80;
+    }
 
     // --- REVERB section (DECAY, SHIMMER, SIZE) ---
     contentPanel.sectionYPositions[0] = y;
@@ -197,7 +209,7 @@ void CinderEditor::resized()
     y += 18;
     {
         int totalW = designW - pad * 2;
-        int meterW = 20;
+        int meterW = animatedVisuals ? 20 : 0;
         int contentW = knobS * 2 + 30 + meterW;  // 2 knobs + gap + meter
         int startX = pad + (totalW - contentW) / 2;
 
@@ -208,7 +220,10 @@ void CinderEditor::resized()
         mixLabel.setBounds(mixX, y, knobS, labelH);
         mixKnob.setBounds(mixX, y + labelH, knobS, knobS);
 
-        int meterX = mixX + knobS + 20;
-        outputMeter.setBounds(meterX, y, meterW, knobS + labelH);
+        if constexpr (animatedVisuals)
+        {
+            int meterX = mixX + knobS + 20;
+            outputMeter->setBounds(meterX, y, meterW, knobS + labelH);
+        }
     }
 }
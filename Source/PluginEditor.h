@@ -6,6 +6,7 @@
 #include "UI/CinderLookAndFeel.h"
 #include "UI/WaveformVisualizer.h"
 #include "UI/OutputMeter.h"
+#include "UI/QualityIndicator.h"
 
 // --- Reusable knob widget ---
 
@@ -47,8 +48,10 @@ public:
     void resized() override;
 
 private:
+    // Lite has no visualiser strip, so its panel is shorter
+    static constexpr bool animatedVisuals = CinderPluginConfig::animatedVisuals;
     static constexpr int designW = 520;
-    static constexpr int designH = 440;
+    static constexpr int designH = animatedVisuals ? 440 : 360;
 
     CinderProcessor& processor;
     CinderLookAndFeel cinderLook;
@@ -58,9 +61,14 @@ private:
     CinderContentPanel contentPanel;
     juce::ComponentBoundsConstrainer constrainer;
 
-    // Visualizer + meter (initialized in constructor with processor refs)
-    WaveformVisualizer waveformVisualizer;
-    OutputMeter outputMeter;
+    // Visualizer + meter: timer-driven, so only created when the build
+    // configuration has animated visuals (never in Lite)
+    std::unique_ptr<WaveformVisualizer> waveformVisualizer;
+    std::unique_ptr<OutputMeter> outputMeter;
+
+    // CPU load / adaptive quality readout in the footer (both configurations:
+    // Lite is the one most likely to run on a stretched machine)
+    QualityIndicator qualityIndicator;
 
     // Knobs — REVERB section
     CinderKnob decayKnob, shimmerKnob, sizeKnob;
@@ -8,18 +8,26 @@ CinderProcessor::CinderProcessor()
       apvts(*this, nullptr, "Parameters", createParameterLayout())
 {
     // Cache parameter pointers for fast access
-    driveParam = apvts.getRawParameterValue("drive");
-    decayParam = apvts.getRawParameterValue("decay");
-    shimmerParam = apvts.getRawParameterValue("shimmer");
-    burnParam = apvts.getRawParameterValue("burn");
-    sizeParam = apvts.getRawParameterValue("size");
-    duckParam = apvts.getRawParameterValue("duck");
-    mixParam = apvts.getRawParameterValue("mix");
-    freezeParam = apvts.getRawParameterValue("freeze");
+    for (int i = 0; i < Engine::numParams; ++i)
+    {
+        parameters[static_cast<size_t>(i)] = apvts.getParameter(paramIDs[static_cast<size_t>(i)]);
+        paramPointers[static_cast<size_t>(i)] = apvts.getRawParameterValue(paramIDs[static_cast<size_t>(i)]);
+    }
+
+    // Nothing else: hosts construct many instances to scan or load a session,
+    // so all DSP memory (both engines) waits for prepareToPlay, sized for the
+    // actual rate and block size. Lite runs one engine, so its worst case
+    // stays a single FDN4.
+    engine.setSpilloverEnabled(CinderPluginConfig::spillover);
+
+    // Program changes may arrive before playback, so the APVTS catch-up polls
+    // from the start (JUCE timers share one message-thread tick)
+    startTimerHz(30);
 }
 
 CinderProcessor::~CinderProcessor()
 {
+    stopTimer();
 }
 
 juce::AudioProcessorValueTreeState::ParameterLayout CinderProcessor::createParameterLayout()
@@ -80,49 +88,157 @@ juce::AudioProcessorValueTreeState::ParameterLayout CinderProcessor::createParam
     params.push_back(std::make_unique<juce::AudioParameterBool>(
         juce::ParameterID{"freeze", 1}, "Freeze", false));
 
+    // LOW / HIGH DECAY: band RT60 as a multiple of DECAY (centred on 1x = flat)
+    auto bandDecayRange = juce::NormalisableRange<float>(0.25f, 4.0f, 0.01f);
+    bandDecayRange.setSkewForCentre(1.0f);
+
+    params.push_back(std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID{"lowdecay", 1},
+        "Low Decay",
+        bandDecayRange,
+        1.0f));
+
+    params.push_back(std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID{"highdecay", 1},
+        "High Decay",
+        bandDecayRange,
+        1.0f));
+
+    // MOD: slow LFOs on the FDN line lengths — smooths metallic ringing in long tails
+    params.push_back(std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID{"mod", 1},
+        "Mod",
+        juce::NormalisableRange<float>(0.0f, 1.0f, 0.01f),
+        0.0f));
+
+    // MORPH: blend from snapshot A to snapshot B (once both are captured)
+    params.push_back(std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID{"morph", 1},
+        "Morph",
+        juce::NormalisableRange<float>(0.0f, 1.0f, 0.001f),
+        0.0f));
+
     return {params.begin(), params.end()};
 }
 
+void CinderProcessor::syncEngineParameters()
+{
+    for (int i = 0; i < Engine::numParams; ++i)
+        engine.setParameter(i, paramPointers[static_cast<size_t>(i)]->load(std::memory_order_relaxed));
+}
+
+void CinderProcessor::captureSnapshot(int slot)
+{
+    if (slot < 0 || slot >= Engine::numSnapshots)
+        return;
+
+    auto& values = snapshotValues[static_cast<size_t>(slot)];
+    for (int i = 0; i < Engine::numParams; ++i)
+        values[static_cast<size_t>(i)] = paramPointers[static_cast<size_t>(i)]->load(std::memory_order_relaxed);
+
+    // The engine works out the snapshot's reverb coefficients here, off the audio thread
+    snapshotStored[static_cast<size_t>(slot)] = true;
+    engine.setSnapshot(slot, values.data());
+}
+
+void CinderProcessor::clearSnapshots()
+{
+    snapshotStored.fill(false);
+    engine.clearSnapshots();
+}
+
+bool CinderProcessor::hasSnapshot(int slot) const
+{
+    return slot >= 0 && slot < Engine::numSnapshots && snapshotStored[static_cast<size_t>(slot)];
+}
+
+void CinderProcessor::readPreset(int index, std::array<float, Engine::numParams>& values) const
+{
+    // Defaults for anything the bank does not store
+    for (int i = 0; i < Engine::numParams; ++i)
+        values[static_cast<size_t>(i)] = Engine::paramRanges[static_cast<size_t>(i)].defaultValue;
+    presetLibrary->readValues(index, values.data(), Engine::numParams);
+}
+
+void CinderProcessor::setCurrentProgram(int index)
+{
+    if (index < 0 || index >= presetLibrary->getNumPresets())
+        return;
+
+    // Hosts call this from the message or the audio thread, sometimes both.
+    // One compare-exchange publishes the program with a fresh generation, so
+    // concurrent callers never lose a change and nothing here locks or
+    // allocates. The audio thread and the timer pick it up from the slot.
+    auto slot = requestedProgram.load(std::memory_order_relaxed);
+    while (! requestedProgram.compare_exchange_weak(slot, packProgram(programGeneration(slot) + 1, index),
+                                                    std::memory_order_release, std::memory_order_relaxed))
+    {
+    }
+}
+
+void CinderProcessor::timerCallback()
+{
+    // One load: if another change lands meanwhile, this round under-reports
+    // and the next tick finishes the job
+    const auto slot = requestedProgram.load(std::memory_order_acquire);
+    const auto generation = programGeneration(slot);
+    if (generation == appliedPresetGeneration.load(std::memory_order_relaxed))
+        return;
+
+    std::array<float, Engine::numParams> values;
+    readPreset(programIndex(slot), values);
+    for (int i = 0; i < Engine::numParams; ++i)
+    {
+        auto* parameter = parameters[static_cast<size_t>(i)];
+        parameter->setValueNotifyingHost(parameter->convertTo0to1(values[static_cast<size_t>(i)]));
+    }
+
+    appliedPresetGeneration.store(generation, std::memory_order_release);
+}
+
+void CinderProcessor::applyPresetChanges()
+{
+    // Only the latest requested program matters
+    const auto slot = requestedProgram.load(std::memory_order_acquire);
+    const auto generation = programGeneration(slot);
+    if (generation == heldPresetGeneration)
+        return;
+
+    // The bank is read-only memory, so reading it here does not block.
+    // The old tail rings on in the second engine while the preset takes the input.
+    std::array<float, Engine::numParams> values;
+    readPreset(programIndex(slot), values);
+    engine.requestSpillover();
+    heldPresetGeneration = generation;
+    for (int i = 0; i < Engine::numParams; ++i)
+        engine.setParameter(i, values[static_cast<size_t>(i)]);
+}
+
 void CinderProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
 {
-    currentSampleRate = sampleRate;
-
-    // Initialize DSP components
-    shimmerReverbL.prepare(sampleRate, samplesPerBlock);
-    shimmerReverbR.prepare(sampleRate, samplesPerBlock);
-
-    // Initialize smoothed parameters (50ms smoothing time)
-    const double smoothingTime = 0.05;
-    driveSmoothed.reset(sampleRate, smoothingTime);
-    decaySmoothed.reset(sampleRate, smoothingTime);
-    shimmerSmoothed.reset(sampleRate, smoothingTime);
-    burnSmoothed.reset(sampleRate, smoothingTime);
-    sizeSmoothed.reset(sampleRate, smoothingTime);
-    duckSmoothed.reset(sampleRate, smoothingTime);
-    mixSmoothed.reset(sampleRate, smoothingTime);
-    freezeSmoothed.reset(sampleRate, smoothingTime);
-
-    // Set initial values
-    driveSmoothed.setCurrentAndTargetValue(*driveParam);
-    decaySmoothed.setCurrentAndTargetValue(*decayParam);
-    shimmerSmoothed.setCurrentAndTargetValue(*shimmerParam);
-    burnSmoothed.setCurrentAndTargetValue(*burnParam);
-    sizeSmoothed.setCurrentAndTargetValue(*sizeParam);
-    duckSmoothed.setCurrentAndTargetValue(*duckParam);
-    mixSmoothed.setCurrentAndTargetValue(*mixParam);
-    freezeSmoothed.setCurrentAndTargetValue(0.0f);
-
-    // Envelope follower coefficients
-    envAttackCoeff = std::exp(-1.0f / (0.0005f * static_cast<float>(sampleRate)));   // 0.5ms attack
-    envReleaseCoeff = std::exp(-1.0f / (0.15f * static_cast<float>(sampleRate)));    // 150ms release
-    envState = 0.0f;
+    // Engine starts its smoothers from the current parameter values. A repeat
+    // call with the same rate and block size (some hosts send one on every
+    // transport or device hiccup) reallocates nothing and keeps the tail.
+    syncEngineParameters();
+    engine.prepare(sampleRate, samplesPerBlock);
+
+    // Load history from another configuration says nothing about this one
+    qualityGovernor.reset();
+    engine.setQualityLevel(0);
+    qualityLevel.store(0, std::memory_order_relaxed);
 }
 
 void CinderProcessor::releaseResources()
 {
-    shimmerReverbL.reset();
-    shimmerReverbR.reset();
-    envState = 0.0f;
+    // Back to the constructed state: no DSP memory until the next prepareToPlay
+    engine.release();
+}
+
+void CinderProcessor::reset()
+{
+    // Clears tails and snaps the smoothers to the current parameter values
+    syncEngineParameters();
+    engine.reset();
 }
 
 void CinderProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer&)
@@ -132,116 +248,106 @@ void CinderProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiB
     const int numChannels = buffer.getNumChannels();
     const int numSamples = buffer.getNumSamples();
 
-    // Update smoothed parameter targets
-    driveSmoothed.setTargetValue(*driveParam);
-    decaySmoothed.setTargetValue(*decayParam);
-    shimmerSmoothed.setTargetValue(*shimmerParam);
-    burnSmoothed.setTargetValue(*burnParam);
-    sizeSmoothed.setTargetValue(*sizeParam);
-    duckSmoothed.setTargetValue(*duckParam);
-    mixSmoothed.setTargetValue(*mixParam);
-    freezeSmoothed.setTargetValue(*freezeParam >= 0.5f ? 1.0f : 0.0f);
+    // Unprepared (or released): pass the input through
+    if (! engine.isPrepared())
+        return;
+
+    // A requested preset overrides the APVTS until the message thread has applied it
+    applyPresetChanges();
+    if (static_cast<std::int32_t>(appliedPresetGeneration.load(std::memory_order_acquire) - heldPresetGeneration) >= 0)
+        syncEngineParameters();
 
     float* leftChannel = buffer.getWritePointer(0);
     float* rightChannel = numChannels > 1 ? buffer.getWritePointer(1) : leftChannel;
 
-    float peakLevel = 0.0f;
-    float sumSquares = 0.0f;
-    float blockPeak = 0.0f;
-
-    for (int i = 0; i < numSamples; ++i)
-    {
-        // Get smoothed parameter values
-        const float drive = driveSmoothed.getNextValue();
-        const float decay = decaySmoothed.getNextValue();
-        const float shimmer = shimmerSmoothed.getNextValue();
-        const float burn = burnSmoothed.getNextValue();
-        const float size = sizeSmoothed.getNextValue();
-        const float duck = duckSmoothed.getNextValue();
-        const float mix = mixSmoothed.getNextValue();
-        const float fz = freezeSmoothed.getNextValue();
-
-        // Check for infinite mode (decay > 29.5s treated as freeze)
-        const bool infiniteMode = decay > 29.5f;
-        const float baseDecay = infiniteMode ? 100.0f : decay;
-        // When frozen, lerp decay toward infinite (100.0)
-        const float actualDecay = baseDecay + fz * (100.0f - baseDecay);
-
-        // 1. Save pristine dry input
-        const float dryL = leftChannel[i];
-        const float dryR = rightChannel[i];
-
-        // 2. Envelope follower on dry signal (for sidechain ducking)
-        const float dryMono = (std::abs(dryL) + std::abs(dryR)) * 0.5f;
-        const float envCoeff = (dryMono > envState) ? envAttackCoeff : envReleaseCoeff;
-        envState = envCoeff * envState + (1.0f - envCoeff) * dryMono;
-
-        // 3. Apply DRIVE saturation (warm input distortion)
-        //    driveGain: 1x (clean) to 6x (heavy saturation)
-        float driveGain = 1.0f + drive * 5.0f;
-        float drivenL = std::tanh(dryL * driveGain);
-        float drivenR = std::tanh(dryR * driveGain);
-
-        // 3b. Gate input when frozen (smoothed to avoid clicks)
-        drivenL *= (1.0f - fz);
-        drivenR *= (1.0f - fz);
-
-        // 4. Update reverb parameters (burn is applied inside the feedback loop)
-        shimmerReverbL.setParameters(actualDecay, shimmer, size, burn);
-        shimmerReverbR.setParameters(actualDecay, shimmer, size, burn);
-
-        // 5. Process shimmer reverb
-        float wetL = shimmerReverbL.process(drivenL);
-        float wetR = shimmerReverbR.process(drivenR);
-
-        // 6. Apply sidechain ducking
-        //    envState is raw amplitude (0-1 range for typical signals).
-        //    Scale by 5x so a signal peaking at ~0.5 drives full ducking.
-        if (duck > 0.001f)
-        {
-            float envScaled = std::min(envState * 5.0f, 1.0f);
-            float duckGain = std::max(0.0f, 1.0f - duck * envScaled);
-            wetL *= duckGain;
-            wetR *= duckGain;
-        }
-
-        // 7. Final dry/wet mix
-        leftChannel[i] = dryL * (1.0f - mix) + wetL * mix;
-        rightChannel[i] = dryR * (1.0f - mix) + wetR * mix;
-
-        // Track peak for visualization
-        peakLevel = std::max(peakLevel, std::abs(wetL));
+    const auto startTicks = juce::Time::getHighResolutionTicks();
+    storeMeters(engine.process(leftChannel, rightChannel, numSamples), numSamples);
+    updateQuality(juce::Time::getHighResolutionTicks() - startTicks, numSamples);
+}
 
-        // Accumulate for output metering
-        float outSample = (leftChannel[i] + rightChannel[i]) * 0.5f;
-        sumSquares += outSample * outSample;
-        blockPeak = std::max(blockPeak, std::abs(outSample));
-    }
+void CinderProcessor::updateQuality(juce::int64 elapsedTicks, int numSamples)
+{
+    // Offline renders have no deadline to miss: always full quality
+    if (isNonRealtime())
+        qualityGovernor.reset();
+    else
+        qualityGovernor.update(juce::Time::highResolutionTicksToSeconds(elapsedTicks),
+                               static_cast<double>(numSamples) / getSampleRate());
+
+    engine.setQualityLevel(qualityGovernor.getLevel());
+    processLoad.store(qualityGovernor.getLoad(), std::memory_order_relaxed);
+    qualityLevel.store(qualityGovernor.getLevel(), std::memory_order_relaxed);
+}
 
+void CinderProcessor::storeMeters(const Engine::Meters& meters, int numSamples)
+{
     // Update visualization level
-    currentReverbLevel.store(peakLevel);
+    currentReverbLevel.store(meters.reverbPeak);
 
     // Update output metering atomics
     if (numSamples > 0)
     {
-        float rms = std::sqrt(sumSquares / static_cast<float>(numSamples));
-        outputRmsLevel.store(rms, std::memory_order_relaxed);
-        outputPeakLevel.store(blockPeak, std::memory_order_relaxed);
+        outputRmsLevel.store(meters.outputRms, std::memory_order_relaxed);
+        outputPeakLevel.store(meters.outputPeak, std::memory_order_relaxed);
     }
 }
 
 void CinderProcessor::getStateInformation(juce::MemoryBlock& destData)
 {
-    auto state = apvts.copyState();
-    std::unique_ptr<juce::XmlElement> xml(state.createXml());
-    copyXmlToBinary(*xml, destData);
+    // Compact binary state (see CinderState.h): one float per parameter
+    std::array<float, Engine::numParams> values;
+    for (int i = 0; i < Engine::numParams; ++i)
+        values[static_cast<size_t>(i)] = paramPointers[static_cast<size_t>(i)]->load(std::memory_order_relaxed);
+
+    // Followed by whichever morph snapshots are stored
+    const float* snapshots[CinderState::maxSnapshots] {};
+    for (int s = 0; s < Engine::numSnapshots; ++s)
+        if (snapshotStored[static_cast<size_t>(s)])
+            snapshots[s] = snapshotValues[static_cast<size_t>(s)].data();
+
+    destData.setSize(CinderState::getSize(Engine::numParams, snapshots));
+    CinderState::write(destData.getData(), values.data(), Engine::numParams, snapshots);
 }
 
 void CinderProcessor::setStateInformation(const void* data, int sizeInBytes)
 {
+    if (sizeInBytes <= 0)
+        return;
+
+    std::array<float, Engine::numParams> values;
+    const int numValues = CinderState::read(data, static_cast<size_t>(sizeInBytes), values.data(), Engine::numParams);
+    if (numValues >= 0)
+    {
+        // Parameters missing from older states go back to their defaults
+        for (int i = 0; i < Engine::numParams; ++i)
+        {
+            auto* parameter = parameters[static_cast<size_t>(i)];
+            parameter->setValueNotifyingHost(i < numValues ? parameter->convertTo0to1(values[static_cast<size_t>(i)])
+                                                           : parameter->getDefaultValue());
+        }
+
+        // Snapshots, with defaults for parameters they predate
+        clearSnapshots();
+        for (int s = 0; s < Engine::numSnapshots; ++s)
+        {
+            auto& snapshot = snapshotValues[static_cast<size_t>(s)];
+            for (int i = 0; i < Engine::numParams; ++i)
+                snapshot[static_cast<size_t>(i)] = Engine::paramRanges[static_cast<size_t>(i)].defaultValue;
+
+            if (CinderState::readSnapshot(data, static_cast<size_t>(sizeInBytes), s, snapshot.data(), Engine::numParams) >= 0)
+            {
+                snapshotStored[static_cast<size_t>(s)] = true;
+                engine.setSnapshot(s, snapshot.data());
+            }
+        }
+        return;
+    }
+
+    // Sessions saved before the binary format: APVTS state as XML
     std::unique_ptr<juce::XmlElement> xml(getXmlFromBinary(data, sizeInBytes));
     if (xml != nullptr && xml->hasTagName(apvts.state.getType()))
     {
+        clearSnapshots();
         apvts.replaceState(juce::ValueTree::fromXml(*xml));
     }
 }
@@ -2,9 +2,14 @@
 
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_dsp/juce_dsp.h>
-#include "DSP/ShimmerReverb.h"
+#include "DSP/CinderConfig.h"
+#include "DSP/SpilloverEngine.h"
+#include "DSP/CinderState.h"
+#include "DSP/QualityGovernor.h"
+#include "PresetLibrary.h"
 
 class CinderProcessor : public juce::AudioProcessor
+                      , private juce::Timer
 {
 public:
     CinderProcessor();
@@ -13,6 +18,7 @@ public:
     // Audio processing
     void prepareToPlay(double sampleRate, int samplesPerBlock) override;
     void releaseResources() override;
+    void reset() override;
     void processBlock(juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
 
     // Plugin info
@@ -22,17 +28,24 @@ public:
     bool isMidiEffect() const override { return false; }
     double getTailLengthSeconds() const override { return 10.0; }
 
-    // Programs (not used, but required)
-    int getNumPrograms() override { return 1; }
-    int getCurrentProgram() override { return 0; }
-    void setCurrentProgram(int) override {}
-    const juce::String getProgramName(int) override { return {}; }
+    // Programs: the factory and user preset banks (see PresetLibrary)
+    int getNumPrograms() override { return std::max(1, presetLibrary->getNumPresets()); }
+    int getCurrentProgram() override { return programIndex(requestedProgram.load(std::memory_order_relaxed)); }
+    void setCurrentProgram(int index) override;
+    const juce::String getProgramName(int index) override { return presetLibrary->getName(index); }
     void changeProgramName(int, const juce::String&) override {}
 
     // State
     void getStateInformation(juce::MemoryBlock& destData) override;
     void setStateInformation(const void* data, int sizeInBytes) override;
 
+    // A/B morph snapshots (message thread): capture stores the current
+    // parameter values as snapshot A (0) or B (1); once both are stored,
+    // MORPH blends between them. Saved with the plugin state.
+    void captureSnapshot(int slot);
+    void clearSnapshots();
+    bool hasSnapshot(int slot) const;
+
     // Editor
     juce::AudioProcessorEditor* createEditor() override;
     bool hasEditor() const override { return true; }
@@ -43,38 +56,69 @@ public:
     std::atomic<float> outputRmsLevel{0.0f};
     std::atomic<float> outputPeakLevel{0.0f};
 
+    // Adaptive quality telemetry: averaged processBlock time as a fraction of
+    // the block deadline, and the engine's quality level (0 = full)
+    static constexpr int numQualityLevels = BasicSpilloverEngine<CinderPluginConfig::fdnOrder>::numQualityLevels;
+    std::atomic<float> processLoad{0.0f};
+    std::atomic<int> qualityLevel{0};
+
 private:
     juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
 
-    // DSP components
-    ShimmerReverb shimmerReverbL, shimmerReverbR;
-
-    // Parameter pointers (for fast access in processBlock)
-    std::atomic<float>* driveParam = nullptr;
-    std::atomic<float>* decayParam = nullptr;
-    std::atomic<float>* shimmerParam = nullptr;
-    std::atomic<float>* burnParam = nullptr;
-    std::atomic<float>* sizeParam = nullptr;
-    std::atomic<float>* duckParam = nullptr;
-    std::atomic<float>* mixParam = nullptr;
-    std::atomic<float>* freezeParam = nullptr;
-
-    // Smoothed parameters to avoid zipper noise
-    juce::SmoothedValue<float> driveSmoothed;
-    juce::SmoothedValue<float> decaySmoothed;
-    juce::SmoothedValue<float> shimmerSmoothed;
-    juce::SmoothedValue<float> burnSmoothed;
-    juce::SmoothedValue<float> sizeSmoothed;
-    juce::SmoothedValue<float> duckSmoothed;
-    juce::SmoothedValue<float> mixSmoothed;
-    juce::SmoothedValue<float> freezeSmoothed;
-
-    // Envelope follower state (for sidechain ducking)
-    float envState = 0.0f;
-    float envAttackCoeff = 0.0f;   // ~0.5ms attack
-    float envReleaseCoeff = 0.0f;  // ~150ms release
-
-    double currentSampleRate = 44100.0;
+    // DSP chain (shared with the C API), sized by the build configuration. Cinder
+    // runs two engines, so tails spill over across preset changes and big
+    // parameter jumps; Cinder Lite runs one (CinderPluginConfig::spillover).
+    using Engine = BasicSpilloverEngine<CinderPluginConfig::fdnOrder>;
+    Engine engine;
+
+    // APVTS parameter IDs, indexed by Engine::Param (also the binary state's slot order)
+    static constexpr std::array<const char*, Engine::numParams> paramIDs {
+        "drive", "decay", "shimmer", "burn", "size", "duck", "mix", "freeze", "lowdecay", "highdecay", "mod", "morph"
+    };
+
+    // Parameter objects (state restore) and pointers (for fast access in processBlock), indexed by Engine::Param
+    std::array<juce::RangedAudioParameter*, Engine::numParams> parameters {};
+    std::array<std::atomic<float>*, Engine::numParams> paramPointers {};
+
+    // Stored snapshots (message thread), mirrored into the engine
+    std::array<std::array<float, Engine::numParams>, Engine::numSnapshots> snapshotValues {};
+    std::array<bool, Engine::numSnapshots> snapshotStored {};
+
+    // Push the current APVTS values into the engine's targets
+    void syncEngineParameters();
+
+    // Program changes: setCurrentProgram() publishes the program and a new
+    // generation in one atomic slot (generation << 32 | index), so any thread
+    // may call it and the latest call wins. The audio thread applies it at its
+    // next block (the engine's smoothers crossfade it) and holds it until the
+    // APVTS has caught up on the message thread (timerCallback). Generations
+    // tell the two apart.
+    static std::uint64_t packProgram(std::uint32_t generation, int index)
+    {
+        return (static_cast<std::uint64_t>(generation) << 32) | static_cast<std::uint32_t>(index);
+    }
+    static std::uint32_t programGeneration(std::uint64_t slot) { return static_cast<std::uint32_t>(slot >> 32); }
+    static int programIndex(std::uint64_t slot) { return static_cast<int>(static_cast<std::uint32_t>(slot)); }
+
+    static_assert(FactoryPresets::numValues == Engine::numParams, "factory presets must store every parameter");
+    static_assert(CinderState::maxSnapshots == Engine::numSnapshots, "the state must hold every snapshot");
+
+    juce::SharedResourcePointer<PresetLibrary> presetLibrary;
+    std::atomic<std::uint64_t> requestedProgram { 0 };
+    std::atomic<std::uint32_t> appliedPresetGeneration { 0 };   // APVTS holds this preset's values
+    std::uint32_t heldPresetGeneration = 0;                      // audio thread: preset the engine is on
+
+    void readPreset(int index, std::array<float, Engine::numParams>& values) const;
+    void applyPresetChanges();
+    void timerCallback() override;
+
+    // Publish block meters to the UI atomics
+    void storeMeters(const Engine::Meters& meters, int numSamples);
+
+    // Adaptive quality: each block's processing time against its deadline
+    // picks the engine's quality level for the next one (see QualityGovernor)
+    QualityGovernor qualityGovernor { Engine::numQualityLevels, CinderPluginConfig::ecoLoad };
+    void updateQuality(juce::int64 elapsedTicks, int numSamples);
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(CinderProcessor)
 };
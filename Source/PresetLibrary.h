@@ -0,0 +1,62 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include "DSP/FactoryPresets.h"
+
+/**
+ * PresetLibrary - Factory and user preset banks, shared by every instance
+ *
+ * The factory bank is an image compiled into the binary. The user bank is a
+ * file in the same PresetBank format (<user app data>/Cinder/User.cinderbank),
+ * memory-mapped once when the first instance is created. Programs number
+ * the factory presets first, then the user ones.
+ *
+ * Both banks are read-only for the life of the library, so any thread (the
+ * audio thread included) may read presets without locks or allocation.
+ * Hold it through juce::SharedResourcePointer.
+ */
+class PresetLibrary
+{
+public:
+    PresetLibrary()
+    {
+        factory.open(FactoryPresets::bankImage.data(), FactoryPresets::bankImage.size());
+
+        const auto file = getUserBankFile();
+        if (file.existsAsFile())
+        {
+            userFile = std::make_unique<juce::MemoryMappedFile>(file, juce::MemoryMappedFile::readOnly);
+            if (userFile->getData() == nullptr || ! user.open(userFile->getData(), userFile->getSize()))
+                userFile.reset();
+        }
+    }
+
+    static juce::File getUserBankFile()
+    {
+        return juce::File::getSpecialLocation(juce::File::userApplicationDataDirectory)
+            .getChildFile("Cinder")
+            .getChildFile("User.cinderbank");
+    }
+
+    int getNumPresets() const { return factory.getNumPresets() + user.getNumPresets(); }
+
+    juce::String getName(int index) const
+    {
+        const auto name = index < factory.getNumPresets() ? factory.getName(index)
+                                                          : user.getName(index - factory.getNumPresets());
+        return juce::String::fromUTF8(name.data(), static_cast<int>(name.size()));
+    }
+
+    // Reads up to maxValues values (Engine::Param order); returns how many
+    int readValues(int index, float* values, int maxValues) const
+    {
+        return index < factory.getNumPresets() ? factory.readValues(index, values, maxValues)
+                                               : user.readValues(index - factory.getNumPresets(), values, maxValues);
+    }
+
+private:
+    PresetBank factory, user;
+    std::unique_ptr<juce::MemoryMappedFile> userFile;
+
+    JUCE_DECLARE_NON_COPYABLE(PresetLibrary)
+};
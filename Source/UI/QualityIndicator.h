@@ -0,0 +1,58 @@
+#pragma once
+#include <juce_gui_basics/juce_gui_basics.h>
+#include <atomic>
+#include "CinderLookAndFeel.h"
+
+// Footer readout of the adaptive quality governor: processing load as a
+// share of the block deadline, and the reduced-quality level when one is active.
+// Polls the processor's atomics at 4fps (text only)
+class QualityIndicator : public juce::Component, public juce::SettableTooltipClient, public juce::Timer
+{
+public:
+    QualityIndicator(std::atomic<float>& loadSource, std::atomic<int>& levelSource, int numLevels)
+        : processLoad(loadSource), qualityLevel(levelSource), maxLevel(numLevels - 1)
+    {
+        setTooltip("CPU load against the block deadline. Under sustained overload, Cinder trades "
+                   "reverb detail for headroom (ECO) and restores it when the load drops.");
+        startTimerHz(4);
+    }
+
+    ~QualityIndicator() override { stopTimer(); }
+
+    void timerCallback() override
+    {
+        const int percent = juce::roundToInt(processLoad.load(std::memory_order_relaxed) * 100.0f);
+        const int level = qualityLevel.load(std::memory_order_relaxed);
+        if (percent != displayPercent || level != displayLevel)
+        {
+            displayPercent = percent;
+            displayLevel = level;
+            repaint();
+        }
+    }
+
+    void paint(juce::Graphics& g) override
+    {
+        auto bounds = getLocalBounds();
+        if (auto* laf = dynamic_cast<CinderLookAndFeel*>(&getLookAndFeel()))
+            g.setFont(laf->getBrandFont());
+
+        if (displayLevel > 0)
+        {
+            g.setColour(juce::Colour(CinderLookAndFeel::colAccent));
+            g.drawText("ECO " + juce::String(displayLevel) + "/" + juce::String(maxLevel),
+                       bounds.removeFromRight(48), juce::Justification::centredRight);
+        }
+
+        g.setColour(juce::Colour(CinderLookAndFeel::colTextDim));
+        g.drawText("CPU " + juce::String(displayPercent) + "%", bounds, juce::Justification::centredRight);
+    }
+
+private:
+    std::atomic<float>& processLoad;
+    std::atomic<int>& qualityLevel;
+    const int maxLevel;
+
+    int displayPercent = -1;
+    int displayLevel = -1;
+};
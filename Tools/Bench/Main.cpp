@@ -0,0 +1,296 @@
+#include "cinder_dsp.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ * CinderBench - Throughput of the CinderDSP kernels at each SIMD level
+ *
+ * Usage:
+ *   CinderBench [--instances 64] [--seconds 10] [--block 256] [--rate 48000]
+ *               [--simd all|generic|avx2|avx512] [--storage float32|float16|int16]
+ *               [--diffusion allpass|velvet]
+ *
+ * For every level this CPU supports (or just the one asked for), renders
+ * `seconds` of audio through a cinder_bank of `instances` reverbs and through
+ * one stereo cinder_dsp, and prints the realtime factor. Bank output is
+ * compared against the generic level so a broken variant shows up as a
+ * large difference, not just a fast time. --storage sets the delay-memory
+ * format of both (see cinder_dsp_set_delay_storage), --diffusion the
+ * engine's input diffuser (see cinder_dsp_set_input_diffusion).
+ *
+ * Then times instance startup as a host loading a session sees it: create
+ * `instances` engines (as the plugin runs them, with spillover), prepare
+ * them and process one block each, and prints each phase per instance and
+ * the total from construction to the first block.
+ */
+
+namespace
+{
+struct Settings
+{
+    int instances = 64;
+    double seconds = 10.0;
+    int blockSize = 256;
+    double sampleRate = 48000.0;
+    std::string simd = "all";
+    cinder_storage storage = CINDER_STORAGE_FLOAT32;
+    cinder_diffusion diffusion = CINDER_DIFFUSION_ALLPASS;
+};
+
+bool parseStorage(const std::string& name, cinder_storage& storage)
+{
+    if (name == "float32")      storage = CINDER_STORAGE_FLOAT32;
+    else if (name == "float16") storage = CINDER_STORAGE_FLOAT16;
+    else if (name == "int16")   storage = CINDER_STORAGE_INT16;
+    else                        return false;
+    return true;
+}
+
+bool parseDiffusion(const std::string& name, cinder_diffusion& diffusion)
+{
+    if (name == "allpass")      diffusion = CINDER_DIFFUSION_ALLPASS;
+    else if (name == "velvet")  diffusion = CINDER_DIFFUSION_VELVET;
+    else                        return false;
+    return true;
+}
+
+bool parseArgs(int argc, char* argv[], Settings& settings)
+{
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        const std::string option = argv[i];
+        const char* value = argv[i + 1];
+
+        if (option == "--instances")     settings.instances = std::atoi(value);
+        else if (option == "--seconds")  settings.seconds = std::atof(value);
+        else if (option == "--block")    settings.blockSize = std::atoi(value);
+        else if (option == "--rate")     settings.sampleRate = std::atof(value);
+        else if (option == "--simd")     settings.simd = value;
+        else if (option == "--storage")  { if (! parseStorage(value, settings.storage)) return false; }
+        else if (option == "--diffusion") { if (! parseDiffusion(value, settings.diffusion)) return false; }
+        else                             return false;
+    }
+    return (argc % 2) == 1 && settings.instances > 0 && settings.seconds > 0.0
+           && settings.blockSize > 0 && settings.sampleRate > 0.0;
+}
+
+// Noise bursts with silence between them, so tails decay and restart
+void fillInput(std::vector<float>& buffer, int offset, double sampleRate, std::mt19937& rng)
+{
+    std::uniform_real_distribution<float> noise(-0.5f, 0.5f);
+    const int period = static_cast<int>(sampleRate);
+    for (size_t i = 0; i < buffer.size(); ++i)
+        buffer[i] = (static_cast<int>(offset + static_cast<int>(i)) % period) < period / 10 ? noise(rng) : 0.0f;
+}
+
+double elapsedSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Renders the bank; returns seconds spent and keeps instance 0's output
+double runBank(const Settings& settings, std::vector<float>& instanceZero)
+{
+    cinder_bank* bank = cinder_bank_create(settings.instances);
+    if (bank == nullptr || cinder_bank_set_delay_storage(bank, settings.storage) != CINDER_OK
+        || cinder_bank_prepare(bank, settings.sampleRate, settings.blockSize) != CINDER_OK)
+    {
+        cinder_bank_destroy(bank);
+        return -1.0;
+    }
+
+    for (int i = 0; i < settings.instances; ++i)
+        cinder_bank_set_instance(bank, i, 0.5f + 0.4f * static_cast<float>(i % 20),
+                                 0.1f * static_cast<float>(i % 8), static_cast<float>(i % 11) / 10.0f, 0.0f);
+
+    std::vector<std::vector<float>> buffers(static_cast<size_t>(settings.instances),
+                                            std::vector<float>(static_cast<size_t>(settings.blockSize)));
+    std::vector<const float*> inputs;
+    std::vector<float*> outputs;
+    for (auto& buffer : buffers)
+    {
+        inputs.push_back(buffer.data());
+        outputs.push_back(buffer.data());
+    }
+
+    std::mt19937 rng(1);
+    const int totalSamples = static_cast<int>(settings.seconds * settings.sampleRate);
+    instanceZero.clear();
+
+    double seconds = 0.0;
+    for (int pos = 0; pos < totalSamples; pos += settings.blockSize)
+    {
+        for (auto& buffer : buffers)
+            fillInput(buffer, pos, settings.sampleRate, rng);
+
+        const auto start = std::chrono::steady_clock::now();
+        cinder_bank_process(bank, inputs.data(), outputs.data(), settings.blockSize);
+        seconds += elapsedSince(start);
+
+        instanceZero.insert(instanceZero.end(), buffers[0].begin(), buffers[0].end());
+    }
+
+    cinder_bank_destroy(bank);
+    return seconds;
+}
+
+// Renders one full stereo engine; returns seconds spent
+double runEngine(const Settings& settings)
+{
+    cinder_dsp* dsp = cinder_dsp_create();
+    if (dsp == nullptr || cinder_dsp_set_delay_storage(dsp, settings.storage) != CINDER_OK
+        || cinder_dsp_set_input_diffusion(dsp, settings.diffusion) != CINDER_OK
+        || cinder_dsp_prepare(dsp, settings.sampleRate, settings.blockSize) != CINDER_OK)
+    {
+        cinder_dsp_destroy(dsp);
+        return -1.0;
+    }
+
+    cinder_dsp_set_param(dsp, CINDER_PARAM_DECAY, 6.0f);
+    cinder_dsp_set_param(dsp, CINDER_PARAM_SHIMMER, 0.5f);
+    cinder_dsp_set_param(dsp, CINDER_PARAM_MIX, 0.5f);
+
+    std::vector<float> left(static_cast<size_t>(settings.blockSize)), right(left.size());
+    std::mt19937 rng(2);
+    const int totalSamples = static_cast<int>(settings.seconds * settings.sampleRate);
+
+    double seconds = 0.0;
+    for (int pos = 0; pos < totalSamples; pos += settings.blockSize)
+    {
+        fillInput(left, pos, settings.sampleRate, rng);
+        fillInput(right, pos, settings.sampleRate, rng);
+
+        const auto start = std::chrono::steady_clock::now();
+        cinder_dsp_process_block(dsp, left.data(), right.data(), left.data(), right.data(), settings.blockSize);
+        seconds += elapsedSince(start);
+    }
+
+    cinder_dsp_destroy(dsp);
+    return seconds;
+}
+struct StartupTimes
+{
+    double create = 0.0, prepare = 0.0, firstBlock = 0.0;   // seconds, all instances
+};
+
+// Create, prepare and first block of `instances` engines, each phase timed
+// across all of them; false if one fails
+bool runStartup(const Settings& settings, StartupTimes& times)
+{
+    std::vector<cinder_dsp*> engines(static_cast<size_t>(settings.instances), nullptr);
+    bool ok = true;
+
+    auto start = std::chrono::steady_clock::now();
+    for (auto& dsp : engines)
+        dsp = cinder_dsp_create();
+    times.create = elapsedSince(start);
+
+    start = std::chrono::steady_clock::now();
+    for (auto* dsp : engines)
+        ok = ok && dsp != nullptr && cinder_dsp_set_spillover(dsp, 1) == CINDER_OK
+             && cinder_dsp_prepare(dsp, settings.sampleRate, settings.blockSize) == CINDER_OK;
+    times.prepare = elapsedSince(start);
+
+    std::vector<float> left(static_cast<size_t>(settings.blockSize)), right(left.size());
+    std::mt19937 rng(3);
+    start = std::chrono::steady_clock::now();
+    for (auto* dsp : engines)
+    {
+        fillInput(left, 0, settings.sampleRate, rng);
+        fillInput(right, 0, settings.sampleRate, rng);
+        ok = ok && cinder_dsp_process_block(dsp, left.data(), right.data(), left.data(), right.data(),
+                                            settings.blockSize) == CINDER_OK;
+    }
+    times.firstBlock = elapsedSince(start);
+
+    for (auto* dsp : engines)
+        cinder_dsp_destroy(dsp);
+    return ok;
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    Settings settings;
+    if (! parseArgs(argc, argv, settings))
+    {
+        std::fprintf(stderr, "usage: CinderBench [--instances N] [--seconds S] [--block B] [--rate R] "
+                             "[--simd all|generic|avx2|avx512] [--storage float32|float16|int16] "
+                             "[--diffusion allpass|velvet]\n");
+        return 1;
+    }
+
+    std::printf("detected: %s, %d instances, %.0f Hz, block %d, %.1f s\n",
+                cinder_simd_level_name(cinder_get_simd_level()), settings.instances,
+                settings.sampleRate, settings.blockSize, settings.seconds);
+    std::printf("%-8s %14s %16s %14s %12s\n", "level", "bank (x rt)", "per instance", "engine (x rt)", "vs generic");
+
+    std::vector<float> reference;
+    bool ranAny = false;
+
+    for (auto level : { CINDER_SIMD_GENERIC, CINDER_SIMD_AVX2, CINDER_SIMD_AVX512 })
+    {
+        const char* name = cinder_simd_level_name(level);
+        const bool wanted = settings.simd == "all" || settings.simd == name;
+
+        // Generic also runs as the reference for the other levels
+        if (! wanted && ! (level == CINDER_SIMD_GENERIC && settings.simd != "generic"))
+            continue;
+
+        if (cinder_force_simd_level(level) != CINDER_OK)
+        {
+            if (wanted)
+                std::printf("%-8s not supported on this CPU\n", name);
+            continue;
+        }
+
+        std::vector<float> instanceZero;
+        const double bankSeconds = runBank(settings, instanceZero);
+        const double engineSeconds = wanted ? runEngine(settings) : 0.0;
+        if (bankSeconds < 0.0 || engineSeconds < 0.0)
+        {
+            std::fprintf(stderr, "%s: prepare failed\n", name);
+            return 1;
+        }
+
+        if (level == CINDER_SIMD_GENERIC)
+            reference = instanceZero;
+
+        double maxDiff = 0.0;
+        for (size_t i = 0; i < reference.size() && i < instanceZero.size(); ++i)
+            maxDiff = std::max(maxDiff, static_cast<double>(std::abs(reference[i] - instanceZero[i])));
+
+        if (wanted)
+        {
+            std::printf("%-8s %14.1f %16.1f %14.1f %12.2e\n", name,
+                        settings.seconds / bankSeconds,
+                        settings.seconds * settings.instances / bankSeconds,
+                        settings.seconds / engineSeconds,
+                        maxDiff);
+            ranAny = true;
+        }
+    }
+
+    cinder_clear_forced_simd_level();
+
+    StartupTimes startup;
+    if (! runStartup(settings, startup))
+    {
+        std::fprintf(stderr, "startup: prepare failed\n");
+        return 1;
+    }
+
+    const double perInstance = 1.0e6 / settings.instances;   // seconds -> us per instance
+    std::printf("\nstartup, %d instances (us per instance): create %.2f, prepare %.1f, first block %.1f, "
+                "construction to first block %.1f\n",
+                settings.instances, startup.create * perInstance, startup.prepare * perInstance,
+                startup.firstBlock * perInstance,
+                (startup.create + startup.prepare + startup.firstBlock) * perInstance);
+    return ranAny ? 0 : 1;
+}
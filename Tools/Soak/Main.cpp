@@ -0,0 +1,356 @@
+#include "CinderEngine.h"
+#include "FlushDenormals.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * CinderSoak - Long-duration stability soak of the engine in sustain modes
+ *
+ * Usage:
+ *   CinderSoak [--hours 1] [--instances <cores>] [--threads <cores>]
+ *              [--block 512] [--rate 48000] [--ftz 0|1] [--log <dir>]
+ *              [--storage float32|float16|int16]
+ *
+ * Every instance is a full CinderEngine running one scenario (infinite decay,
+ * freeze, with and without BURN/SHIMMER/DRIVE), excited for a few seconds and
+ * then left to sustain on its own for `hours` of simulated audio, as fast as
+ * the CPU allows. Instances are spread over worker threads.
+ *
+ * For every block it tracks energy (RMS), NaN/Inf and subnormal sample
+ * counts, plus DC (mean) over each second once the excitation has ended, and
+ * records the first block that breaks a bound. FTZ/DAZ is
+ * off by default so denormal collapse in the loop shows up in the counts
+ * (the plugin and C API both run with it on). --log writes one CSV per
+ * instance with per-second RMS, DC and counts. --storage picks the delay
+ * memory format (SampleStorage). Exits non-zero if any instance violated a
+ * bound.
+ */
+
+namespace
+{
+struct Settings
+{
+    double hours = 1.0;
+    int instances = 0;   // 0 = one per hardware thread
+    int threads = 0;     // 0 = hardware threads
+    int blockSize = 512;
+    double sampleRate = 48000.0;
+    bool flushDenormals = false;
+    std::string logDir;
+    SampleStorage storage = SampleStorage::float32;
+};
+
+bool parseStorage(const std::string& name, SampleStorage& storage)
+{
+    if (name == "float32")      storage = SampleStorage::float32;
+    else if (name == "float16") storage = SampleStorage::float16;
+    else if (name == "int16")   storage = SampleStorage::int16;
+    else                        return false;
+    return true;
+}
+
+bool parseArgs(int argc, char* argv[], Settings& settings)
+{
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        const std::string option = argv[i];
+        const char* value = argv[i + 1];
+
+        if (option == "--hours")           settings.hours = std::atof(value);
+        else if (option == "--instances")  settings.instances = std::atoi(value);
+        else if (option == "--threads")    settings.threads = std::atoi(value);
+        else if (option == "--block")      settings.blockSize = std::atoi(value);
+        else if (option == "--rate")       settings.sampleRate = std::atof(value);
+        else if (option == "--ftz")        settings.flushDenormals = std::atoi(value) != 0;
+        else if (option == "--log")        settings.logDir = value;
+        else if (option == "--storage")    { if (! parseStorage(value, settings.storage)) return false; }
+        else                               return false;
+    }
+    return (argc % 2) == 1 && settings.hours > 0.0 && settings.instances >= 0 && settings.threads >= 0
+           && settings.blockSize > 0 && settings.sampleRate > 0.0;
+}
+
+struct Scenario
+{
+    const char* name;
+    float drive, decay, shimmer, burn, size;
+    bool freeze;   // engaged once the excitation ends
+};
+
+// Decay 30 is the infinite setting (> 29.5)
+const Scenario scenarios[] = {
+    { "infinite",              0.0f, 30.0f, 0.0f, 0.0f, 0.5f, false },
+    { "infinite+shimmer",      0.0f, 30.0f, 1.0f, 0.0f, 0.8f, false },
+    { "infinite+burn+shimmer", 1.0f, 30.0f, 1.0f, 1.0f, 1.0f, false },
+    { "freeze",                0.0f,  4.0f, 0.0f, 0.0f, 0.5f, true  },
+    { "freeze+burn",           0.6f,  4.0f, 0.0f, 1.0f, 0.7f, true  },
+    { "freeze+burn+shimmer",   1.0f, 10.0f, 1.0f, 0.8f, 1.0f, true  },
+};
+constexpr int numScenarios = static_cast<int>(std::size(scenarios));
+
+// Bounds on the mixed output (MIX = 1, so the output is the wet signal)
+constexpr double maxBlockRms = 2.0;     // the loop limiters keep it well below this
+constexpr double maxWindowDc = 0.05;    // mean over each second
+constexpr double excitationSeconds = 3.0;
+
+struct Result
+{
+    int instance = 0;
+    const Scenario* scenario = nullptr;
+    long long blocks = 0;
+    double peakRms = 0.0;
+    double finalRms = 0.0;
+    double maxDc = 0.0;
+    long long nonFinite = 0;
+    long long subnormals = 0;
+    long long firstViolation = -1;   // block index
+    std::string violation;
+    double silentAfterSeconds = -1.0;   // first time the tail fell below -120 dB
+    double realtimeFactor = 0.0;        // a drop here without FTZ = denormal stalls
+};
+
+struct BlockStats
+{
+    double sumSquares = 0.0;
+    double sum = 0.0;
+    int nonFinite = 0;
+    int subnormals = 0;
+};
+
+BlockStats measure(const float* left, const float* right, int numSamples)
+{
+    BlockStats stats;
+    for (const float* channel : { left, right })
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const float x = channel[i];
+            switch (std::fpclassify(x))
+            {
+                case FP_NAN:
+                case FP_INFINITE:  ++stats.nonFinite; continue;
+                case FP_SUBNORMAL: ++stats.subnormals; break;
+                default: break;
+            }
+            stats.sumSquares += static_cast<double>(x) * x;
+            stats.sum += x;
+        }
+    return stats;
+}
+
+// Noise bursts, then silence; deterministic per instance
+void fillExcitation(float* left, float* right, int numSamples, long long position, double sampleRate, uint32_t& seed)
+{
+    const auto excitationEnd = static_cast<long long>(excitationSeconds * sampleRate);
+    const auto burstPeriod = static_cast<long long>(0.25 * sampleRate);
+    for (int i = 0; i < numSamples; ++i)
+    {
+        const long long t = position + i;
+        float l = 0.0f, r = 0.0f;
+        if (t < excitationEnd && (t % burstPeriod) < burstPeriod / 3)
+        {
+            seed = seed * 1664525u + 1013904223u;
+            l = (static_cast<float>(seed >> 8) / 16777216.0f - 0.5f) * 1.2f;
+            seed = seed * 1664525u + 1013904223u;
+            r = (static_cast<float>(seed >> 8) / 16777216.0f - 0.5f) * 1.2f;
+        }
+        left[i] = l;
+        right[i] = r;
+    }
+}
+
+Result soak(int instance, const Settings& settings)
+{
+    const Scenario& scenario = scenarios[instance % numScenarios];
+    Result result;
+    result.instance = instance;
+    result.scenario = &scenario;
+
+    CinderEngine engine;
+    engine.setParameter(CinderEngine::drive, scenario.drive);
+    engine.setParameter(CinderEngine::decay, scenario.decay);
+    engine.setParameter(CinderEngine::shimmer, scenario.shimmer);
+    engine.setParameter(CinderEngine::burn, scenario.burn);
+    engine.setParameter(CinderEngine::size, scenario.size);
+    engine.setParameter(CinderEngine::duck, 0.0f);
+    engine.setParameter(CinderEngine::mix, 1.0f);
+    engine.setDelayStorage(settings.storage);
+    engine.prepare(settings.sampleRate, settings.blockSize);
+
+    std::ofstream log;
+    if (! settings.logDir.empty())
+    {
+        log.open(settings.logDir + "/soak_" + std::to_string(instance) + ".csv");
+        log << "seconds,rms,dc,non_finite,subnormals\n";
+    }
+
+    std::vector<float> left(static_cast<size_t>(settings.blockSize)), right(left.size());
+    const auto start = std::chrono::steady_clock::now();
+    uint32_t seed = 1u + static_cast<uint32_t>(instance);
+
+    const auto totalSamples = static_cast<long long>(settings.hours * 3600.0 * settings.sampleRate);
+    const auto excitationEnd = static_cast<long long>(excitationSeconds * settings.sampleRate);
+    const auto samplesPerWindow = static_cast<long long>(settings.sampleRate);
+    BlockStats window;
+    long long windowSamples = 0;
+    bool frozen = false;
+
+    auto flagViolation = [&result](const char* reason) {
+        if (result.firstViolation < 0)
+        {
+            result.firstViolation = result.blocks;
+            result.violation = reason;
+        }
+    };
+
+    for (long long pos = 0; pos < totalSamples; pos += settings.blockSize, ++result.blocks)
+    {
+        const int n = static_cast<int>(std::min<long long>(settings.blockSize, totalSamples - pos));
+
+        if (scenario.freeze && ! frozen && pos >= excitationEnd)
+        {
+            engine.setParameter(CinderEngine::freeze, 1.0f);
+            frozen = true;
+        }
+
+        fillExcitation(left.data(), right.data(), n, pos, settings.sampleRate, seed);
+        engine.process(left.data(), right.data(), n);
+
+        // Per block: energy, NaN/Inf and subnormals
+        const auto stats = measure(left.data(), right.data(), n);
+        const double rms = std::sqrt(stats.sumSquares / (2.0 * n));
+
+        result.peakRms = std::max(result.peakRms, rms);
+        result.finalRms = rms;
+        result.nonFinite += stats.nonFinite;
+        result.subnormals += stats.subnormals;
+
+        if (stats.nonFinite > 0)
+            flagViolation("NaN/Inf");
+        else if (stats.subnormals > 0)
+            flagViolation("subnormal output");
+        else if (rms > maxBlockRms)
+            flagViolation("energy blow-up");
+
+        if (result.silentAfterSeconds < 0.0 && pos >= excitationEnd && rms < 1.0e-6)
+            result.silentAfterSeconds = static_cast<double>(pos) / settings.sampleRate;
+
+        // DC needs a window longer than a block, or bass reads as offset
+        window.sumSquares += stats.sumSquares;
+        window.sum += stats.sum;
+        window.nonFinite += stats.nonFinite;
+        window.subnormals += stats.subnormals;
+        windowSamples += n;
+        if (windowSamples >= samplesPerWindow)
+        {
+            const double count = 2.0 * static_cast<double>(windowSamples);
+            const double dc = window.sum / count;
+
+            // The noise bursts themselves have a mean, so only the sustain is bounded
+            if (pos + n - windowSamples >= excitationEnd)
+            {
+                result.maxDc = std::max(result.maxDc, std::abs(dc));
+                if (std::abs(dc) > maxWindowDc)
+                    flagViolation("DC drift");
+            }
+
+            if (log.is_open())
+                log << static_cast<double>(pos + n) / settings.sampleRate << ',' << std::sqrt(window.sumSquares / count)
+                    << ',' << dc << ',' << window.nonFinite << ',' << window.subnormals << '\n';
+
+            window = {};
+            windowSamples = 0;
+        }
+    }
+
+    const double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    result.realtimeFactor = static_cast<double>(totalSamples) / settings.sampleRate / std::max(wallSeconds, 1.0e-9);
+    return result;
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    Settings settings;
+    if (! parseArgs(argc, argv, settings))
+    {
+        std::fprintf(stderr, "usage: CinderSoak [--hours H] [--instances N] [--threads T] [--block B] "
+                             "[--rate R] [--ftz 0|1] [--log dir] [--storage float32|float16|int16]\n");
+        return 1;
+    }
+
+    const int hardwareThreads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    const int numInstances = settings.instances > 0 ? settings.instances : std::max(hardwareThreads, numScenarios);
+    const int numThreads = std::min(numInstances, settings.threads > 0 ? settings.threads : hardwareThreads);
+
+    std::printf("%d instances on %d threads, %.2f h each at %.0f Hz, block %d, FTZ %s\n", numInstances, numThreads,
+                settings.hours, settings.sampleRate, settings.blockSize, settings.flushDenormals ? "on" : "off");
+
+    std::vector<Result> results(static_cast<size_t>(numInstances));
+    std::atomic<int> nextInstance { 0 };
+    std::mutex printLock;
+
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (int t = 0; t < numThreads; ++t)
+        workers.emplace_back([&] {
+            std::unique_ptr<FlushDenormals> noDenormals;
+            if (settings.flushDenormals)
+                noDenormals = std::make_unique<FlushDenormals>();
+
+            for (int i = nextInstance++; i < numInstances; i = nextInstance++)
+            {
+                results[static_cast<size_t>(i)] = soak(i, settings);
+
+                const std::lock_guard<std::mutex> lock(printLock);
+                std::printf("  instance %d (%s) done\n", i, results[static_cast<size_t>(i)].scenario->name);
+                std::fflush(stdout);
+            }
+        });
+    for (auto& worker : workers)
+        worker.join();
+
+    const double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    const double blockSeconds = settings.blockSize / settings.sampleRate;
+
+    std::printf("\n%-4s %-22s %9s %9s %9s %8s %10s %10s %7s  %s\n", "inst", "scenario", "peak rms", "end rms",
+                "max dc", "nan/inf", "subnormal", "silent at", "x rt", "first violation");
+
+    int failures = 0;
+    for (const auto& result : results)
+    {
+        char silent[32] = "-";
+        if (result.silentAfterSeconds >= 0.0)
+            std::snprintf(silent, sizeof(silent), "%.0fs", result.silentAfterSeconds);
+
+        std::string violation = "none";
+        if (result.firstViolation >= 0)
+        {
+            char text[96];
+            std::snprintf(text, sizeof(text), "%s at block %lld (%.1fs)", result.violation.c_str(),
+                          result.firstViolation, static_cast<double>(result.firstViolation) * blockSeconds);
+            violation = text;
+            ++failures;
+        }
+
+        std::printf("%-4d %-22s %9.2e %9.2e %9.2e %8lld %10lld %10s %7.1f  %s\n", result.instance,
+                    result.scenario->name, result.peakRms, result.finalRms, result.maxDc, result.nonFinite,
+                    result.subnormals, silent, result.realtimeFactor, violation.c_str());
+    }
+
+    const double simulated = settings.hours * 3600.0 * numInstances;
+    std::printf("\n%.1f h of audio in %.1f s (%.0fx realtime)\n", simulated / 3600.0, wallSeconds, simulated / wallSeconds);
+
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,120 @@
+#include "SweepRenderer.h"
+
+/**
+ * CinderSweep - Offline parameter-grid renderer for dataset generation
+ *
+ * Usage:
+ *   CinderSweep --spec sweep.json --input <file|dir> --out <dir> [--threads N]
+ *
+ * Spec (JSON):
+ *   {
+ *     "blockSize": 512, "tailSeconds": 4.0, "shardSize": 256,
+ *     "grid":   { "decay": [0.5, 2, 8], "size": { "from": 0, "to": 1, "steps": 5 } }
+ *     // or
+ *     "random": { "count": 5000, "seed": 7, "params": { "decay": { "from": 0.1, "to": 30 } } }
+ *   }
+ */
+
+static juce::Array<juce::File> collectInputs(const juce::File& input)
+{
+    juce::Array<juce::File> files;
+
+    if (input.isDirectory())
+    {
+        files = input.findChildFiles(juce::File::findFiles, true, "*.wav;*.aif;*.aiff;*.flac");
+        files.sort();
+    }
+    else if (input.existsAsFile())
+    {
+        files.add(input);
+    }
+    return files;
+}
+
+int main(int argc, char* argv[])
+{
+    // APVTS needs a message manager, even though nothing here is on screen
+    juce::ScopedJuceInitialiser_GUI juceInit;
+
+    const juce::ArgumentList args(argc, argv);
+    const auto specFile = juce::File::getCurrentWorkingDirectory().getChildFile(args.getValueForOption("--spec"));
+    const auto inputPath = juce::File::getCurrentWorkingDirectory().getChildFile(args.getValueForOption("--input"));
+    const auto outputDir = juce::File::getCurrentWorkingDirectory().getChildFile(args.getValueForOption("--out"));
+
+    if (! specFile.existsAsFile() || args.getValueForOption("--out").isEmpty())
+    {
+        std::cerr << "usage: CinderSweep --spec sweep.json --input <file|dir> --out <dir> [--threads N]" << std::endl;
+        return 1;
+    }
+
+    const auto spec = juce::JSON::parse(specFile);
+    if (! spec.isObject())
+    {
+        std::cerr << "could not parse " << specFile.getFullPathName() << std::endl;
+        return 1;
+    }
+
+    const auto inputs = collectInputs(inputPath);
+    if (inputs.isEmpty())
+    {
+        std::cerr << "no input audio found at " << inputPath.getFullPathName() << std::endl;
+        return 1;
+    }
+
+    // Resolve the spec against a scratch processor's parameter layout
+    ParameterSweep sweep;
+    {
+        CinderProcessor layout;
+        juce::String error;
+        if (! sweep.parse(spec, layout.apvts, error))
+        {
+            std::cerr << "bad spec: " << error << std::endl;
+            return 1;
+        }
+    }
+
+    SweepRenderer::Settings settings;
+    settings.outputDir = outputDir;
+    settings.blockSize = juce::jlimit(16, 8192, static_cast<int>(spec.getProperty("blockSize", 512)));
+    settings.tailSeconds = juce::jmax(0.0, static_cast<double>(spec.getProperty("tailSeconds", 4.0)));
+    settings.shardSize = juce::jmax(1, static_cast<int>(spec.getProperty("shardSize", 256)));
+    settings.numWorkers = args.containsOption("--threads")
+                              ? juce::jmax(1, args.getValueForOption("--threads").getIntValue())
+                              : juce::SystemStats::getNumCpus();
+
+    if (! outputDir.createDirectory())
+    {
+        std::cerr << "could not create " << outputDir.getFullPathName() << std::endl;
+        return 1;
+    }
+    specFile.copyFileTo(outputDir.getChildFile("spec.json"));
+
+    SourceCache cache(inputs, sweep.getNumCombinations());
+    SweepRenderer renderer(settings, sweep, cache);
+    renderer.createWorkers();
+
+    std::cout << inputs.size() << " inputs x " << sweep.getNumCombinations() << " combinations = "
+              << renderer.getTotalJobs() << " renders on " << settings.numWorkers << " threads" << std::endl;
+
+    const auto startMs = juce::Time::getMillisecondCounterHiRes();
+    std::thread progress([&renderer] {
+        while (renderer.getCompletedJobs() < renderer.getTotalJobs())
+        {
+            std::this_thread::sleep_for(std::chrono::seconds(2));
+            std::cout << "  " << renderer.getCompletedJobs() << " / " << renderer.getTotalJobs() << std::endl;
+        }
+    });
+
+    renderer.run();
+    progress.join();
+
+    const auto seconds = (juce::Time::getMillisecondCounterHiRes() - startMs) / 1000.0;
+    std::cout << "done in " << seconds << " s, " << renderer.getFailedJobs() << " failed" << std::endl;
+
+    if (! renderer.writeManifest())
+    {
+        std::cerr << "could not write manifest" << std::endl;
+        return 1;
+    }
+    return renderer.getFailedJobs() > 0 ? 2 : 0;
+}
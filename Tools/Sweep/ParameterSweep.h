@@ -0,0 +1,189 @@
+#pragma once
+
+#include <juce_audio_processors/juce_audio_processors.h>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+/**
+ * ParameterSweep - Lazily expanded parameter combinations for dataset renders
+ *
+ * The spec selects one of two modes:
+ * - "grid":   cartesian product of per-parameter value lists. A combination is
+ *             decoded from its index as a mixed-radix number, so no table of
+ *             combinations is ever built.
+ * - "random": N combinations drawn uniformly in each parameter's normalised
+ *             range. Every index seeds its own generator, so any combination
+ *             can be regenerated on its own from (seed, index).
+ *
+ * Axis values are either an explicit list [0.5, 2.0, 8.0] or a range
+ * {"from": 0, "to": 1, "steps": 5}. Ranges are spaced in the parameter's
+ * normalised domain so skewed controls (DECAY) are spread like the knob.
+ * Parameters the spec doesn't mention keep their defaults.
+ */
+class ParameterSweep
+{
+public:
+    struct Axis
+    {
+        juce::String paramId;
+        juce::NormalisableRange<float> range;
+        std::vector<float> values;        // grid mode (real-world units)
+        float normFrom = 0.0f;            // random mode (normalised bounds)
+        float normTo = 1.0f;
+    };
+
+    bool parse(const juce::var& spec, juce::AudioProcessorValueTreeState& apvts, juce::String& error)
+    {
+        axes.clear();
+
+        const auto& gridSpec = spec["grid"];
+        const auto& randomSpec = spec["random"];
+
+        if (gridSpec.isObject() == randomSpec.isObject())
+        {
+            error = "spec needs exactly one of \"grid\" or \"random\"";
+            return false;
+        }
+
+        randomMode = randomSpec.isObject();
+        const auto& paramSpec = randomMode ? randomSpec["params"] : gridSpec;
+
+        auto* paramObject = paramSpec.getDynamicObject();
+        if (paramObject == nullptr)
+        {
+            error = randomMode ? "\"random\" needs a \"params\" object" : "\"grid\" must be an object";
+            return false;
+        }
+
+        for (const auto& entry : paramObject->getProperties())
+        {
+            Axis axis;
+            axis.paramId = entry.name.toString();
+
+            auto* param = apvts.getParameter(axis.paramId);
+            if (param == nullptr)
+            {
+                error = "unknown parameter \"" + axis.paramId + "\"";
+                return false;
+            }
+            axis.range = param->getNormalisableRange();
+
+            if (! (randomMode ? parseRandomAxis(entry.value, axis) : parseGridAxis(entry.value, axis)))
+            {
+                error = "bad values for \"" + axis.paramId + "\"";
+                return false;
+            }
+            axes.push_back(std::move(axis));
+        }
+
+        if (randomMode)
+        {
+            randomCount = static_cast<juce::int64>(randomSpec.getProperty("count", 0));
+            seed = static_cast<std::uint64_t>(static_cast<juce::int64>(randomSpec.getProperty("seed", 1)));
+            if (randomCount <= 0)
+            {
+                error = "\"random\" needs a positive \"count\"";
+                return false;
+            }
+            return true;
+        }
+
+        // Guard the mixed-radix product against overflow
+        gridCount = 1;
+        for (const auto& axis : axes)
+        {
+            const auto n = static_cast<juce::int64>(axis.values.size());
+            if (gridCount > std::numeric_limits<juce::int64>::max() / n)
+            {
+                error = "grid is too large";
+                return false;
+            }
+            gridCount *= n;
+        }
+        return true;
+    }
+
+    juce::int64 getNumCombinations() const { return randomMode ? randomCount : gridCount; }
+
+    const std::vector<Axis>& getAxes() const { return axes; }
+
+    // Fills `values` (one per axis, real-world units) for combination `index`
+    void getCombination(juce::int64 index, std::vector<float>& values) const
+    {
+        values.resize(axes.size());
+
+        if (randomMode)
+        {
+            std::uint64_t state = seed ^ (static_cast<std::uint64_t>(index) * 0x9E3779B97F4A7C15ull);
+            for (size_t a = 0; a < axes.size(); ++a)
+            {
+                const auto& axis = axes[a];
+                const float u = static_cast<float>(splitMix64(state) >> 40) / static_cast<float>(1 << 24);
+                const float norm = axis.normFrom + u * (axis.normTo - axis.normFrom);
+                values[a] = axis.range.snapToLegalValue(axis.range.convertFrom0to1(norm));
+            }
+            return;
+        }
+
+        // Mixed radix: the last axis varies fastest
+        for (size_t a = axes.size(); a-- > 0;)
+        {
+            const auto n = static_cast<juce::int64>(axes[a].values.size());
+            values[a] = axes[a].values[static_cast<size_t>(index % n)];
+            index /= n;
+        }
+    }
+
+private:
+    std::vector<Axis> axes;
+    bool randomMode = false;
+    juce::int64 gridCount = 1;
+    juce::int64 randomCount = 0;
+    std::uint64_t seed = 1;
+
+    static std::uint64_t splitMix64(std::uint64_t& state)
+    {
+        std::uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+    static bool parseGridAxis(const juce::var& v, Axis& axis)
+    {
+        if (auto* list = v.getArray())
+        {
+            for (const auto& item : *list)
+                axis.values.push_back(axis.range.snapToLegalValue(static_cast<float>(item)));
+            return ! axis.values.empty();
+        }
+
+        if (! v.isObject())
+            return false;
+
+        const int steps = v.getProperty("steps", 0);
+        if (steps < 1)
+            return false;
+
+        const float from = axis.range.convertTo0to1(static_cast<float>(v.getProperty("from", axis.range.start)));
+        const float to = axis.range.convertTo0to1(static_cast<float>(v.getProperty("to", axis.range.end)));
+
+        for (int i = 0; i < steps; ++i)
+        {
+            const float t = steps > 1 ? static_cast<float>(i) / static_cast<float>(steps - 1) : 0.0f;
+            axis.values.push_back(axis.range.snapToLegalValue(axis.range.convertFrom0to1(from + t * (to - from))));
+        }
+        return true;
+    }
+
+    static bool parseRandomAxis(const juce::var& v, Axis& axis)
+    {
+        if (! v.isObject())
+            return false;
+
+        axis.normFrom = axis.range.convertTo0to1(static_cast<float>(v.getProperty("from", axis.range.start)));
+        axis.normTo = axis.range.convertTo0to1(static_cast<float>(v.getProperty("to", axis.range.end)));
+        return true;
+    }
+};
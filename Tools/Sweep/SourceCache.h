@@ -0,0 +1,115 @@
+#pragma once
+
+#include <juce_audio_formats/juce_audio_formats.h>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/**
+ * SourceCache - Decode-once, share-read-only input audio for the sweep workers
+ *
+ * Each input file is memory-mapped (falling back to a streaming reader for
+ * formats JUCE can't map) and decoded into a float buffer the first time a
+ * worker asks for it. Every later job on that input reuses the same
+ * immutable buffer, so decode cost is paid once per input rather than once
+ * per parameter combination.
+ *
+ * Jobs are handed out input-major, so only the inputs currently in flight
+ * are resident: once the last job for an input releases it, the decoded
+ * audio is dropped.
+ */
+class SourceCache
+{
+public:
+    struct Source
+    {
+        juce::File file;
+        juce::AudioBuffer<float> audio;
+        double sampleRate = 0.0;
+    };
+
+    SourceCache(const juce::Array<juce::File>& files, juce::int64 jobsPerSource)
+    {
+        formats.registerBasicFormats();
+
+        for (const auto& file : files)
+        {
+            auto entry = std::make_unique<Entry>();
+            entry->file = file;
+            entry->remainingJobs.store(jobsPerSource);
+            entries.push_back(std::move(entry));
+        }
+    }
+
+    int getNumSources() const { return static_cast<int>(entries.size()); }
+    const juce::File& getFile(int index) const { return entries[static_cast<size_t>(index)]->file; }
+
+    // Returns the decoded input, decoding it on first use. nullptr if unreadable.
+    std::shared_ptr<const Source> acquire(int index)
+    {
+        auto& entry = *entries[static_cast<size_t>(index)];
+        const std::lock_guard<std::mutex> lock(entry.lock);
+
+        if (entry.source == nullptr && ! entry.failed)
+        {
+            entry.source = decode(entry.file);
+            entry.failed = (entry.source == nullptr);
+        }
+        return entry.source;
+    }
+
+    // Call once per finished job; frees the decode after the input's last job
+    void release(int index)
+    {
+        auto& entry = *entries[static_cast<size_t>(index)];
+        if (entry.remainingJobs.fetch_sub(1) == 1)
+        {
+            const std::lock_guard<std::mutex> lock(entry.lock);
+            entry.source.reset();
+        }
+    }
+
+private:
+    struct Entry
+    {
+        juce::File file;
+        std::mutex lock;
+        std::shared_ptr<const Source> source;
+        std::atomic<juce::int64> remainingJobs{0};
+        bool failed = false;
+    };
+
+    juce::AudioFormatManager formats;
+    std::vector<std::unique_ptr<Entry>> entries;
+
+    std::shared_ptr<const Source> decode(const juce::File& file)
+    {
+        std::unique_ptr<juce::AudioFormatReader> reader;
+
+        // Map the whole file so decoding reads straight from the page cache
+        if (auto* format = formats.findFormatForFileExtension(file.getFileExtension()))
+        {
+            std::unique_ptr<juce::MemoryMappedAudioFormatReader> mapped(format->createMemoryMappedReader(file));
+            if (mapped != nullptr && mapped->mapEntireFile())
+                reader = std::move(mapped);
+        }
+
+        if (reader == nullptr)
+            reader.reset(formats.createReaderFor(file));
+
+        if (reader == nullptr || reader->lengthInSamples <= 0
+            || reader->lengthInSamples > std::numeric_limits<int>::max())
+            return nullptr;
+
+        auto source = std::make_shared<Source>();
+        source->file = file;
+        source->sampleRate = reader->sampleRate;
+        source->audio.setSize(static_cast<int>(reader->numChannels), static_cast<int>(reader->lengthInSamples));
+
+        if (! reader->read(&source->audio, 0, source->audio.getNumSamples(), 0, true, true))
+            return nullptr;
+
+        return source;
+    }
+};
@@ -0,0 +1,213 @@
+#pragma once
+
+#include "PluginProcessor.h"
+#include "ParameterSweep.h"
+#include "SourceCache.h"
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * SweepRenderer - Renders every (input, combination) job across a worker pool
+ *
+ * Job index = input * numCombinations + combination, handed out from one
+ * atomic counter so workers stay on the same input (and share its decode)
+ * for as long as possible.
+ *
+ * Each worker owns one CinderProcessor for the whole run. Between jobs it is
+ * re-prepared only when the input sample rate changes; otherwise it is just
+ * reset, which clears the tails and snaps the smoothers to the new values.
+ *
+ * Renders are written as float WAVs grouped into shard directories of
+ * `shardSize` jobs, and described by one manifest.jsonl line per job.
+ */
+class SweepRenderer
+{
+public:
+    struct Settings
+    {
+        juce::File outputDir;
+        int blockSize = 512;
+        double tailSeconds = 4.0;
+        int shardSize = 256;
+        int numWorkers = 1;
+    };
+
+    SweepRenderer(const Settings& s, const ParameterSweep& p, SourceCache& c)
+        : settings(s), sweep(p), cache(c)
+    {
+        totalJobs = static_cast<juce::int64>(cache.getNumSources()) * sweep.getNumCombinations();
+    }
+
+    juce::int64 getTotalJobs() const { return totalJobs; }
+    juce::int64 getCompletedJobs() const { return completedJobs.load(std::memory_order_relaxed); }
+    juce::int64 getFailedJobs() const { return failedJobs.load(std::memory_order_relaxed); }
+
+    // Builds the workers. Call on the message thread (APVTS construction).
+    void createWorkers()
+    {
+        for (int i = 0; i < settings.numWorkers; ++i)
+            workers.push_back(std::make_unique<Worker>(*this));
+    }
+
+    void run()
+    {
+        std::vector<std::thread> threads;
+        for (auto& worker : workers)
+            threads.emplace_back([&worker] { worker->run(); });
+        for (auto& thread : threads)
+            thread.join();
+    }
+
+    bool writeManifest() const
+    {
+        auto sorted = manifest;
+        std::sort(sorted.begin(), sorted.end(),
+                  [](const auto& a, const auto& b) { return a.first < b.first; });
+
+        const auto file = settings.outputDir.getChildFile("manifest.jsonl");
+        file.deleteFile();
+
+        juce::FileOutputStream out(file);
+        if (! out.openedOk())
+            return false;
+
+        for (const auto& line : sorted)
+            out << line.second << "\n";
+        return true;
+    }
+
+private:
+    class Worker
+    {
+    public:
+        explicit Worker(SweepRenderer& r) : owner(r)
+        {
+            for (const auto& axis : owner.sweep.getAxes())
+                axisParams.push_back(processor.apvts.getParameter(axis.paramId));
+        }
+
+        void run()
+        {
+            for (;;)
+            {
+                const auto job = owner.nextJob.fetch_add(1);
+                if (job >= owner.totalJobs)
+                    return;
+
+                const auto numCombinations = owner.sweep.getNumCombinations();
+                const int sourceIndex = static_cast<int>(job / numCombinations);
+
+                if (auto source = owner.cache.acquire(sourceIndex))
+                    render(job, job % numCombinations, *source);
+                else
+                    owner.failedJobs.fetch_add(1);
+
+                owner.cache.release(sourceIndex);
+                owner.completedJobs.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+    private:
+        SweepRenderer& owner;
+        CinderProcessor processor;
+        std::vector<juce::RangedAudioParameter*> axisParams;
+        std::vector<float> values;
+        juce::AudioBuffer<float> output;
+        juce::MidiBuffer midi;
+        double preparedRate = 0.0;
+
+        void render(juce::int64 job, juce::int64 combination, const SourceCache::Source& source)
+        {
+            const auto& settings = owner.settings;
+
+            if (source.sampleRate != preparedRate)
+            {
+                processor.setPlayConfigDetails(2, 2, source.sampleRate, settings.blockSize);
+                processor.setNonRealtime(true);   // full quality however busy the workers keep the CPU
+                processor.prepareToPlay(source.sampleRate, settings.blockSize);
+                preparedRate = source.sampleRate;
+            }
+
+            owner.sweep.getCombination(combination, values);
+            for (size_t a = 0; a < axisParams.size(); ++a)
+                axisParams[a]->setValueNotifyingHost(axisParams[a]->convertTo0to1(values[a]));
+            processor.reset();
+
+            // Input (mono inputs feed both sides), then silence for the tail
+            const int inputLength = source.audio.getNumSamples();
+            const int totalLength = inputLength + static_cast<int>(settings.tailSeconds * source.sampleRate);
+            output.setSize(2, totalLength, false, false, true);
+            output.clear();
+            for (int ch = 0; ch < 2; ++ch)
+                output.copyFrom(ch, 0, source.audio, std::min(ch, source.audio.getNumChannels() - 1), 0, inputLength);
+
+            for (int pos = 0; pos < totalLength; pos += settings.blockSize)
+            {
+                const int n = std::min(settings.blockSize, totalLength - pos);
+                juce::AudioBuffer<float> block(output.getArrayOfWritePointers(), 2, pos, n);
+                processor.processBlock(block, midi);
+            }
+
+            const int shard = static_cast<int>(job / settings.shardSize);
+            const auto shardDir = settings.outputDir.getChildFile("shard_" + juce::String(shard).paddedLeft('0', 5));
+            const auto file = shardDir.getChildFile("job_" + juce::String(job).paddedLeft('0', 9) + ".wav");
+
+            if (! writeWav(file, source.sampleRate))
+            {
+                owner.failedJobs.fetch_add(1);
+                return;
+            }
+
+            auto* entry = new juce::DynamicObject();
+            entry->setProperty("job", job);
+            entry->setProperty("input", source.file.getFullPathName());
+            entry->setProperty("file", file.getRelativePathFrom(settings.outputDir).replaceCharacter('\\', '/'));
+            entry->setProperty("shard", shard);
+            entry->setProperty("sampleRate", source.sampleRate);
+            entry->setProperty("numSamples", totalLength);
+
+            auto* params = new juce::DynamicObject();
+            for (size_t a = 0; a < axisParams.size(); ++a)
+                params->setProperty(axisParams[a]->getParameterID(), values[a]);
+            entry->setProperty("params", juce::var(params));
+
+            const std::lock_guard<std::mutex> lock(owner.manifestLock);
+            owner.manifest.emplace_back(job, juce::JSON::toString(juce::var(entry), true));
+        }
+
+        bool writeWav(const juce::File& file, double sampleRate)
+        {
+            file.getParentDirectory().createDirectory();
+            file.deleteFile();
+
+            auto stream = std::make_unique<juce::FileOutputStream>(file);
+            if (! stream->openedOk())
+                return false;
+
+            juce::WavAudioFormat wav;
+            std::unique_ptr<juce::AudioFormatWriter> writer(
+                wav.createWriterFor(stream.get(), sampleRate, 2, 32, {}, 0));
+            if (writer == nullptr)
+                return false;
+
+            stream.release(); // owned by the writer now
+            return writer->writeFromAudioSampleBuffer(output, 0, output.getNumSamples());
+        }
+    };
+
+    Settings settings;
+    const ParameterSweep& sweep;
+    SourceCache& cache;
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    juce::int64 totalJobs = 0;
+    std::atomic<juce::int64> nextJob{0};
+    std::atomic<juce::int64> completedJobs{0};
+    std::atomic<juce::int64> failedJobs{0};
+
+    std::mutex manifestLock;
+    std::vector<std::pair<juce::int64, juce::String>> manifest;
+};
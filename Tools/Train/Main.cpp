@@ -0,0 +1,287 @@
+#include <juce_audio_formats/juce_audio_formats.h>
+#include <juce_audio_processors/juce_audio_processors.h>
+#include <juce_gui_basics/juce_gui_basics.h>
+#include <atomic>
+#include <iostream>
+#include <thread>
+
+/**
+ * CinderTrain - PGO training workload for an instrumented Cinder build
+ *
+ * Usage:
+ *   CinderTrain --plugin <Cinder.vst3> [--seconds 2] [--no-editor]
+ *   CinderTrain --write-sweep-input <dir>
+ *
+ * Loads the built plugin (the profile has to come from that binary, not a
+ * copy of its sources) and runs typical presets at common sample rates and
+ * block sizes through processBlock, with programme material that exercises
+ * the limiter, ducking and freeze paths. Then opens the editor and lets it
+ * animate against live audio so the paint code is profiled too.
+ *
+ * --write-sweep-input writes short training files for CinderSweep
+ * (Tools/Train/TrainingSweep.json), which profiles the CLI renderer.
+ */
+
+namespace
+{
+struct Preset
+{
+    const char* name;
+    // Normalised values by parameter name; decay uses the skewed 0..1 range
+    std::vector<std::pair<juce::String, float>> values;
+};
+
+const std::vector<Preset> presets {
+    { "default",        {} },
+    { "small room",     { { "Decay", 0.25f }, { "Size", 0.2f }, { "Mix", 0.25f } } },
+    { "shimmer hall",   { { "Decay", 0.7f }, { "Shimmer", 0.7f }, { "Size", 0.9f }, { "Mix", 0.5f } } },
+    { "burnt",          { { "Drive", 0.6f }, { "Burn", 0.8f }, { "Decay", 0.55f }, { "Mix", 0.6f } } },
+    { "ducked pad",     { { "Duck", 0.8f }, { "Decay", 0.8f }, { "Shimmer", 0.3f }, { "Mix", 0.7f } } },
+    { "infinite",       { { "Decay", 1.0f }, { "Shimmer", 0.5f }, { "Mix", 1.0f } } },
+    { "frozen",         { { "Freeze", 1.0f }, { "Decay", 0.6f }, { "Burn", 0.3f }, { "Mix", 0.8f } } },
+};
+
+const std::vector<double> sampleRates { 44100.0, 48000.0, 96000.0 };
+const std::vector<int> blockSizes { 32, 128, 512, 1024 };
+
+// Programme material: drum-like hits, a sine sweep, noise swells and silence,
+// so envelopes rise and fall and tails get to decay
+class TrainingSignal
+{
+public:
+    explicit TrainingSignal(double rate) : sampleRate(rate) {}
+
+    void fill(juce::AudioBuffer<float>& buffer)
+    {
+        for (int i = 0; i < buffer.getNumSamples(); ++i)
+        {
+            const double t = static_cast<double>(position++) / sampleRate;
+            const double section = std::fmod(t, 8.0);
+            float left = 0.0f, right = 0.0f;
+
+            if (section < 2.0)
+            {
+                // Hits every 250ms: decaying noise bursts
+                const double sinceHit = std::fmod(section, 0.25);
+                const float env = static_cast<float>(std::exp(-sinceHit * 30.0));
+                left = env * (random.nextFloat() * 2.0f - 1.0f) * 0.9f;
+                right = env * (random.nextFloat() * 2.0f - 1.0f) * 0.9f;
+            }
+            else if (section < 4.0)
+            {
+                // Log sine sweep 40Hz..12kHz, hot enough to saturate
+                const double progress = (section - 2.0) / 2.0;
+                phase += juce::MathConstants<double>::twoPi * 40.0 * std::pow(300.0, progress) / sampleRate;
+                left = right = static_cast<float>(std::sin(phase)) * 0.8f;
+            }
+            else if (section < 6.0)
+            {
+                // Noise swell
+                const float env = static_cast<float>(std::sin((section - 4.0) / 2.0 * juce::MathConstants<double>::pi));
+                left = env * (random.nextFloat() * 2.0f - 1.0f) * 0.5f;
+                right = env * (random.nextFloat() * 2.0f - 1.0f) * 0.5f;
+            }
+            // else: silence (tails only)
+
+            buffer.setSample(0, i, left);
+            buffer.setSample(1, i, right);
+        }
+    }
+
+private:
+    double sampleRate;
+    juce::int64 position = 0;
+    double phase = 0.0;
+    juce::Random random { 1 };
+};
+
+void applyPreset(juce::AudioPluginInstance& plugin, const Preset& preset)
+{
+    for (auto* param : plugin.getParameters())
+    {
+        param->setValueNotifyingHost(param->getDefaultValue());
+        for (const auto& [name, value] : preset.values)
+            if (param->getName(64) == name)
+                param->setValueNotifyingHost(value);
+    }
+}
+
+void render(juce::AudioPluginInstance& plugin, double rate, int blockSize, double seconds)
+{
+    juce::AudioBuffer<float> buffer(2, blockSize);
+    juce::MidiBuffer midi;
+    TrainingSignal signal(rate);
+
+    const auto numBlocks = static_cast<int>(seconds * rate / blockSize);
+    for (int b = 0; b < numBlocks; ++b)
+    {
+        signal.fill(buffer);
+        plugin.processBlock(buffer, midi);
+    }
+}
+
+// Audio keeps running on a worker while the editor animates on the message thread
+void trainEditor(juce::AudioPluginInstance& plugin, double seconds)
+{
+    constexpr double rate = 48000.0;
+    constexpr int blockSize = 256;
+
+    plugin.setPlayConfigDetails(2, 2, rate, blockSize);
+    plugin.prepareToPlay(rate, blockSize);
+    applyPreset(plugin, presets[2]);
+
+    std::unique_ptr<juce::AudioProcessorEditor> editor(plugin.createEditorIfNeeded());
+    if (editor == nullptr)
+        return;
+
+    juce::DocumentWindow window("CinderTrain", juce::Colours::black, 0);
+    window.setContentNonOwned(editor.get(), true);
+    window.setVisible(true);
+
+    std::atomic<bool> running { true };
+    std::thread audio([&] {
+        juce::AudioBuffer<float> buffer(2, blockSize);
+        juce::MidiBuffer midi;
+        TrainingSignal signal(rate);
+        while (running.load())
+        {
+            signal.fill(buffer);
+            plugin.processBlock(buffer, midi);
+            std::this_thread::sleep_for(std::chrono::microseconds(static_cast<int>(1.0e6 * blockSize / rate)));
+        }
+    });
+
+    // Step through the editor's size range too, to cover the layout code.
+    // The editor's constrainer keeps every size valid.
+    const int baseWidth = editor->getWidth();
+    const int baseHeight = editor->getHeight();
+    const auto startMs = juce::Time::getMillisecondCounterHiRes();
+    for (int step = 0; juce::Time::getMillisecondCounterHiRes() - startMs < seconds * 1000.0; ++step)
+    {
+        if (step % 20 == 0)
+        {
+            const float scale = 0.8f + 0.2f * static_cast<float>((step / 20) % 4);
+            editor->setSize(juce::roundToInt(static_cast<float>(baseWidth) * scale),
+                            juce::roundToInt(static_cast<float>(baseHeight) * scale));
+        }
+        juce::MessageManager::getInstance()->runDispatchLoopUntil(50);
+    }
+
+    running.store(false);
+    audio.join();
+
+    window.clearContentComponent();
+    editor.reset();
+    plugin.releaseResources();
+}
+
+bool writeSweepInput(const juce::File& dir)
+{
+    if (! dir.createDirectory())
+        return false;
+
+    struct Spec { const char* name; double rate; int channels; };
+    for (const auto& spec : { Spec { "train_44k_stereo.wav", 44100.0, 2 },
+                              Spec { "train_48k_mono.wav", 48000.0, 1 },
+                              Spec { "train_96k_stereo.wav", 96000.0, 2 } })
+    {
+        juce::AudioBuffer<float> audio(2, static_cast<int>(spec.rate * 8.0));
+        TrainingSignal(spec.rate).fill(audio);
+
+        const auto file = dir.getChildFile(spec.name);
+        file.deleteFile();
+        auto stream = std::make_unique<juce::FileOutputStream>(file);
+        if (! stream->openedOk())
+            return false;
+
+        juce::WavAudioFormat wav;
+        std::unique_ptr<juce::AudioFormatWriter> writer(
+            wav.createWriterFor(stream.get(), spec.rate, static_cast<unsigned int>(spec.channels), 24, {}, 0));
+        if (writer == nullptr)
+            return false;
+
+        stream.release(); // owned by the writer now
+        if (! writer->writeFromAudioSampleBuffer(audio, 0, audio.getNumSamples()))
+            return false;
+    }
+    return true;
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInit;
+    const juce::ArgumentList args(argc, argv);
+
+    if (args.containsOption("--write-sweep-input"))
+    {
+        const auto dir = juce::File::getCurrentWorkingDirectory().getChildFile(args.getValueForOption("--write-sweep-input"));
+        if (! writeSweepInput(dir))
+        {
+            std::cerr << "could not write training input to " << dir.getFullPathName() << std::endl;
+            return 1;
+        }
+        return 0;
+    }
+
+    const auto pluginPath = args.getValueForOption("--plugin");
+    if (pluginPath.isEmpty())
+    {
+        std::cerr << "usage: CinderTrain --plugin <Cinder.vst3> [--seconds 2] [--no-editor]\n"
+                     "       CinderTrain --write-sweep-input <dir>" << std::endl;
+        return 1;
+    }
+
+    const double seconds = args.containsOption("--seconds") ? juce::jmax(0.1, args.getValueForOption("--seconds").getDoubleValue())
+                                                           : 2.0;
+
+    juce::VST3PluginFormat format;
+    juce::OwnedArray<juce::PluginDescription> types;
+    format.findAllTypesForFile(types, juce::File::getCurrentWorkingDirectory().getChildFile(pluginPath).getFullPathName());
+    if (types.isEmpty())
+    {
+        std::cerr << "no VST3 plugin found at " << pluginPath << std::endl;
+        return 1;
+    }
+
+    juce::String error;
+    auto plugin = format.createInstanceFromDescription(*types[0], sampleRates[0], blockSizes[0], error);
+    if (plugin == nullptr)
+    {
+        std::cerr << "could not load plugin: " << error << std::endl;
+        return 1;
+    }
+
+    // Audio: every preset at every rate and block size. Rendered flat out, so
+    // marked offline: the adaptive quality governor would otherwise read the
+    // missing deadline as overload and profile the reduced-quality paths.
+    plugin->setNonRealtime(true);
+    for (const auto rate : sampleRates)
+        for (const auto blockSize : blockSizes)
+        {
+            plugin->setPlayConfigDetails(2, 2, rate, blockSize);
+            plugin->prepareToPlay(rate, blockSize);
+
+            for (const auto& preset : presets)
+            {
+                applyPreset(*plugin, preset);
+                plugin->reset();
+                render(*plugin, rate, blockSize, seconds);
+            }
+
+            plugin->releaseResources();
+            std::cout << "  " << rate << " Hz / " << blockSize << " samples" << std::endl;
+        }
+
+    // State round trip, as hosts do on save/load
+    juce::MemoryBlock state;
+    plugin->getStateInformation(state);
+    plugin->setStateInformation(state.getData(), static_cast<int>(state.getSize()));
+
+    plugin->setNonRealtime(false);
+    if (! args.containsOption("--no-editor"))
+        trainEditor(*plugin, seconds * 5.0);
+
+    std::cout << "training done" << std::endl;
+    return 0;
+}
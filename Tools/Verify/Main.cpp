@@ -0,0 +1,661 @@
+#include "CinderEngine.h"
+#include "FlushDenormals.h"
+#include "LofiDegrader.h"
+#include "ShimmerReverb.h"
+#include "ShimmerReverbBatch.h"
+#include "Wavefolder.h"
+#include "Kernels/Kernels.h"
+#include "Reference/CinderEngine.h"
+#include "Reference/LofiDegrader.h"
+#include "Reference/ShimmerReverb.h"
+#include "Reference/Wavefolder.h"
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <string>
+#include <vector>
+
+/**
+ * CinderVerify - Optimised DSP checked against the frozen reference kernels
+ *
+ * Usage:
+ *   CinderVerify [--seconds 4] [--rate 48000] [--simd all|generic|avx2|avx512]
+ *
+ * Runs every optimised kernel next to its scalar reference (Source/DSP/Reference)
+ * on noise, a sine sweep and an impulse train. For each pair it prints the max
+ * abs error, the RMS error, the mean log-spectral difference and the worst
+ * short-term level difference in dB, and checks them against the kernel's
+ * tolerances. SIMD kernels run once per level this CPU supports. Exits
+ * non-zero if any check fails.
+ *
+ * Tolerances are per kernel. Exact ports must match to float rounding. The
+ * batch reverb (control-rate parameters, Pade tanh) must stay close per
+ * sample. The FDN's whole-sample taps (they move each line up to half a
+ * sample) and feedback DC blockers are switched off for the reference
+ * comparisons. The shimmer FDN is
+ * held per sample where its loop is linear; where the energy governor
+ * engages, its tail legitimately decorrelates from the reference and is
+ * held to level and band spectra, and the check fails if the governor never
+ * did engage. The 16-bit delay storage modes are held per sample to the
+ * float path they replace.
+ */
+
+namespace
+{
+using Signal = std::vector<float>;
+
+struct Settings
+{
+    double seconds = 4.0;
+    double sampleRate = 48000.0;
+    std::string simd = "all";
+};
+
+bool parseArgs(int argc, char* argv[], Settings& settings)
+{
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        const std::string option = argv[i];
+        const char* value = argv[i + 1];
+
+        if (option == "--seconds")       settings.seconds = std::atof(value);
+        else if (option == "--rate")     settings.sampleRate = std::atof(value);
+        else if (option == "--simd")     settings.simd = value;
+        else                             return false;
+    }
+    return (argc % 2) == 1 && settings.seconds > 0.0 && settings.sampleRate > 0.0;
+}
+
+// --- Test signals: excitation for the first half, then silence for the tail ---
+
+struct TestSignal
+{
+    const char* name;
+    Signal samples;
+};
+
+std::vector<TestSignal> makeSignals(const Settings& settings)
+{
+    const auto length = static_cast<size_t>(settings.seconds * settings.sampleRate);
+    const size_t excitation = length / 2;
+    std::vector<TestSignal> signals;
+
+    // White noise (fixed LCG so every run and platform sees the same input)
+    Signal noise(length, 0.0f);
+    uint32_t state = 1;
+    for (size_t i = 0; i < excitation; ++i)
+    {
+        state = state * 1664525u + 1013904223u;
+        noise[i] = (static_cast<float>(state >> 8) / 16777216.0f - 0.5f) * 0.8f;
+    }
+    signals.push_back({ "noise", std::move(noise) });
+
+    // Log sine sweep, 20 Hz .. 20 kHz (or Nyquist)
+    Signal sweep(length, 0.0f);
+    const double top = std::min(20000.0, settings.sampleRate * 0.45);
+    double phase = 0.0;
+    for (size_t i = 0; i < excitation; ++i)
+    {
+        const double progress = static_cast<double>(i) / static_cast<double>(excitation);
+        phase += 2.0 * 3.14159265358979 * 20.0 * std::pow(top / 20.0, progress) / settings.sampleRate;
+        sweep[i] = static_cast<float>(std::sin(phase)) * 0.7f;
+    }
+    signals.push_back({ "sweep", std::move(sweep) });
+
+    // Unit impulses every 500ms
+    Signal impulses(length, 0.0f);
+    const auto period = static_cast<size_t>(settings.sampleRate * 0.5);
+    for (size_t i = 0; i < excitation; i += period)
+        impulses[i] = 1.0f;
+    signals.push_back({ "impulses", std::move(impulses) });
+
+    return signals;
+}
+
+// --- Error metrics ---
+
+struct Errors
+{
+    double maxAbs = 0.0;
+    double rms = 0.0;
+    double spectralDb = 0.0;   // mean |dB difference| over audible bins
+    double levelDb = 0.0;      // worst |dB difference| of short-term RMS
+};
+
+struct Tolerance
+{
+    double maxAbs, rms, spectralDb, levelDb;
+};
+
+bool withinTolerance(const Errors& errors, const Tolerance& tolerance)
+{
+    // Written so that NaN errors fail
+    return errors.maxAbs <= tolerance.maxAbs && errors.rms <= tolerance.rms
+           && errors.spectralDb <= tolerance.spectralDb && errors.levelDb <= tolerance.levelDb;
+}
+
+void fft(std::vector<std::complex<double>>& x)
+{
+    const size_t n = x.size();
+    for (size_t i = 1, j = 0; i < n; ++i)
+    {
+        size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1)
+            j ^= bit;
+        j ^= bit;
+        if (i < j)
+            std::swap(x[i], x[j]);
+    }
+
+    for (size_t len = 2; len <= n; len <<= 1)
+    {
+        const double angle = -2.0 * 3.14159265358979 / static_cast<double>(len);
+        const std::complex<double> root(std::cos(angle), std::sin(angle));
+        for (size_t i = 0; i < n; i += len)
+        {
+            std::complex<double> w(1.0, 0.0);
+            for (size_t k = 0; k < len / 2; ++k)
+            {
+                const auto u = x[i + k];
+                const auto v = x[i + k + len / 2] * w;
+                x[i + k] = u + v;
+                x[i + k + len / 2] = u - v;
+                w *= root;
+            }
+        }
+    }
+}
+
+// Third-octave band energies of Hann-windowed spectra, averaged over
+// segments of 16 frames (~0.35s at 48 kHz), compared in dB. Reverb tails are
+// noise-like, so bin-by-bin or sample-by-sample comparisons would flag
+// changes no one can hear (a half-sample shift of one line decorrelates the
+// whole tail). Bands more than 60 dB below the segment's loudest reference
+// band, or below -100 dBFS, are ignored.
+double spectralDifference(const Signal& reference, const Signal& test)
+{
+    constexpr size_t frameSize = 2048;
+    constexpr size_t hop = 1024;
+    constexpr size_t framesPerSegment = 16;
+    constexpr size_t numBins = frameSize / 2 + 1;
+    std::vector<std::complex<double>> a(frameSize), b(frameSize);
+    std::vector<double> powerA(numBins), powerB(numBins);
+
+    // Band edges in bins, a third of an octave apart, from bin 2 up
+    std::vector<size_t> bandEdges { 2 };
+    while (bandEdges.back() < numBins)
+        bandEdges.push_back(std::max(bandEdges.back() + 1,
+                                     static_cast<size_t>(static_cast<double>(bandEdges.back()) * 1.2599)));
+    bandEdges.back() = numBins;
+
+    double sum = 0.0;
+    size_t count = 0;
+    size_t frameInSegment = 0;
+    for (size_t start = 0; start + frameSize <= reference.size(); start += hop)
+    {
+        for (size_t i = 0; i < frameSize; ++i)
+        {
+            const double window = 0.5 - 0.5 * std::cos(2.0 * 3.14159265358979 * static_cast<double>(i) / frameSize);
+            a[i] = reference[start + i] * window;
+            b[i] = test[start + i] * window;
+        }
+        fft(a);
+        fft(b);
+        for (size_t k = 0; k < numBins; ++k)
+        {
+            powerA[k] += std::norm(a[k]);
+            powerB[k] += std::norm(b[k]);
+        }
+
+        if (++frameInSegment < framesPerSegment)
+            continue;
+
+        std::vector<double> bandA, bandB;
+        for (size_t band = 0; band + 1 < bandEdges.size(); ++band)
+        {
+            double ea = 0.0, eb = 0.0;
+            for (size_t k = bandEdges[band]; k < bandEdges[band + 1]; ++k)
+            {
+                ea += powerA[k];
+                eb += powerB[k];
+            }
+            bandA.push_back(ea);
+            bandB.push_back(eb);
+        }
+
+        // -100 dBFS: a one-bin band of noise at 1e-5 RMS (a Hann frame's power gain is 0.375)
+        constexpr double silence = framesPerSegment * frameSize * 0.375 * 1.0e-10;
+        const double peak = *std::max_element(bandA.begin(), bandA.end());
+        const double floor = std::max(peak * 1.0e-6, silence);
+        for (size_t band = 0; band < bandA.size(); ++band)
+        {
+            if (bandA[band] < floor)
+                continue;
+            sum += std::abs(10.0 * std::log10(std::max(bandB[band], 1.0e-30) / bandA[band]));
+            ++count;
+        }
+
+        std::fill(powerA.begin(), powerA.end(), 0.0);
+        std::fill(powerB.begin(), powerB.end(), 0.0);
+        frameInSegment = 0;
+    }
+    return count > 0 ? sum / static_cast<double>(count) : 0.0;
+}
+
+// Short-term RMS (100 ms windows) compared in dB, worst window. Catches a
+// loop that is louder or quieter than the reference even where the band
+// average looks fine. Windows where the reference is below -60 dBFS are
+// ignored.
+double levelDifference(const Signal& reference, const Signal& test, double sampleRate)
+{
+    const auto windowSize = static_cast<size_t>(sampleRate * 0.1);
+    constexpr double silence = 1.0e-6;   // -60 dBFS, as a mean square
+
+    double worst = 0.0;
+    for (size_t start = 0; start + windowSize <= reference.size(); start += windowSize)
+    {
+        double sumA = 0.0, sumB = 0.0;
+        for (size_t i = start; i < start + windowSize; ++i)
+        {
+            sumA += static_cast<double>(reference[i]) * reference[i];
+            sumB += static_cast<double>(test[i]) * test[i];
+        }
+        if (sumA < silence * static_cast<double>(windowSize))
+            continue;
+
+        const double difference = std::abs(10.0 * std::log10(std::max(sumB, 1.0e-30) / sumA));
+        worst = std::isnan(difference) ? difference : std::max(worst, difference);
+    }
+    return worst;
+}
+
+Errors compare(const Signal& reference, const Signal& test, double sampleRate)
+{
+    Errors errors;
+    double sumSquares = 0.0;
+    for (size_t i = 0; i < reference.size(); ++i)
+    {
+        const double diff = std::abs(static_cast<double>(test[i]) - static_cast<double>(reference[i]));
+        errors.maxAbs = std::isnan(diff) ? diff : std::max(errors.maxAbs, diff);
+        sumSquares += diff * diff;
+    }
+    errors.rms = reference.empty() ? 0.0 : std::sqrt(sumSquares / static_cast<double>(reference.size()));
+    errors.spectralDb = spectralDifference(reference, test);
+    errors.levelDb = levelDifference(reference, test, sampleRate);
+    return errors;
+}
+
+// --- Kernel pairs: each renders (reference, optimised) for one input signal ---
+
+struct RenderPair
+{
+    Signal reference, optimised;
+    bool covered = true;   // false if the render missed the regime its check is for
+};
+
+struct Check
+{
+    std::string name;
+    Tolerance tolerance;
+    std::function<RenderPair(const Signal&)> render;
+};
+
+struct ReverbSetting
+{
+    float decay, shimmer, size, burn;
+};
+
+// Infinite mode, a bright shimmer hall and a short burnt room
+const ReverbSetting reverbSettings[] = {
+    { 100.0f, 0.5f, 0.5f, 0.0f },
+    { 3.0f,   0.7f, 0.9f, 0.0f },
+    { 0.6f,   0.0f, 0.2f, 0.8f },
+};
+
+// Linear loop: no BURN, and the input 14 dB down so that neither the
+// reference's limiters nor the energy governor or safety saturator engage
+const ReverbSetting linearSettings[] = {
+    { 3.0f, 0.3f, 0.7f, 0.0f },
+    { 1.2f, 0.5f, 0.9f, 0.0f },
+    { 2.0f, 0.0f, 0.3f, 0.0f },
+};
+constexpr float linearInputGain = 0.2f;
+
+// Driven loop: BURN and the full-level signals push every line past the
+// governor's target, so its gain (and the saturators) shape the tail
+const ReverbSetting governedSettings[] = {
+    { 2.0f, 0.0f, 0.5f, 0.5f },
+    { 8.0f, 0.2f, 0.9f, 0.2f },
+};
+
+constexpr int blockSize = 256;
+
+// The FDN reads fractional taps with linear interpolation and has no DC
+// blockers, as the reference. `covered` is false unless the governor behaved as the settings
+// intend: never engaged for the linear ones, engaged by every setting for
+// the driven ones (its gain dipped below 0.95).
+template <size_t numSettings>
+RenderPair renderShimmer(const Signal& input, double sampleRate, const ReverbSetting (&settings)[numSettings],
+                         float inputGain, bool governed)
+{
+    RenderPair out;
+
+    for (const auto& setting : settings)
+    {
+        reference::ShimmerReverb referenceReverb;
+        ShimmerReverb reverb;
+        reverb.setIntegerTaps(false);
+        reverb.setDcBlocking(false);
+        reverb.setDelayInterpolation(DelayBuffer::Interpolation::linear);
+        referenceReverb.prepare(sampleRate, blockSize);
+        reverb.prepare(sampleRate, blockSize);
+
+        float minGovernorGain = 1.0f;
+        for (const float sample : input)
+        {
+            referenceReverb.setParameters(setting.decay, setting.shimmer, setting.size, setting.burn);
+            reverb.setParameters(setting.decay, setting.shimmer, setting.size, setting.burn);
+            out.reference.push_back(referenceReverb.process(sample * inputGain));
+            out.optimised.push_back(reverb.process(sample * inputGain));
+            minGovernorGain = std::min(minGovernorGain, reverb.getGovernorGain());
+        }
+
+        out.covered = out.covered && (governed ? minGovernorGain < 0.95f : minGovernorGain == 1.0f);
+    }
+    return out;
+}
+
+// 16-bit delay memory against the float path, both with the default linear,
+// whole-sample-tap reads. BURN is 0 for the same reason as below: the
+// saturated loop turns the quantisation noise into a different (equally
+// valid) tail.
+RenderPair renderShimmerStorage(const Signal& input, double sampleRate, SampleStorage storage)
+{
+    Signal ref, opt;
+
+    for (const auto& setting : reverbSettings)
+    {
+        ShimmerReverb floatReverb, packedReverb;
+        packedReverb.setDelayStorage(storage);
+        floatReverb.prepare(sampleRate, blockSize);
+        packedReverb.prepare(sampleRate, blockSize);
+
+        for (size_t i = 0; i < input.size(); ++i)
+        {
+            floatReverb.setParameters(setting.decay, setting.shimmer, setting.size, 0.0f);
+            packedReverb.setParameters(setting.decay, setting.shimmer, setting.size, 0.0f);
+            ref.push_back(floatReverb.process(input[i]));
+            opt.push_back(packedReverb.process(input[i]));
+        }
+    }
+    return { std::move(ref), std::move(opt) };
+}
+
+// Every lane against its own reference instance. BURN is left at 0: the
+// saturated loop is chaotic, so the Pade tanh's 1e-4 error grows without bound
+// there and only a perceptual comparison would be meaningful.
+RenderPair renderShimmerBatch(const Signal& input, double sampleRate, SampleStorage storage = SampleStorage::float32)
+{
+    constexpr int numLanes = ShimmerReverbBatch::numLanes;
+    constexpr int numSettings = 2;
+
+    ShimmerReverbBatch batch;
+    batch.setDelayStorage(storage);
+    batch.prepare(sampleRate, blockSize);
+
+    std::vector<reference::ShimmerReverb> references(numLanes);
+    for (int lane = 0; lane < numLanes; ++lane)
+    {
+        const auto& setting = reverbSettings[lane % numSettings];
+        batch.setParameters(lane, setting.decay, setting.shimmer, setting.size, 0.0f);
+        references[static_cast<size_t>(lane)].prepare(sampleRate, blockSize);
+    }
+
+    // Lane k hears the input scaled by a lane-specific gain, so lanes differ
+    std::vector<Signal> laneBuffers(numLanes, Signal(blockSize));
+    std::vector<const float*> inputs;
+    std::vector<float*> outputs;
+    for (auto& buffer : laneBuffers)
+    {
+        inputs.push_back(buffer.data());
+        outputs.push_back(buffer.data());
+    }
+
+    RenderPair out;
+    for (size_t pos = 0; pos < input.size(); pos += blockSize)
+    {
+        const int n = static_cast<int>(std::min<size_t>(blockSize, input.size() - pos));
+        for (int lane = 0; lane < numLanes; ++lane)
+            for (int i = 0; i < n; ++i)
+                laneBuffers[static_cast<size_t>(lane)][static_cast<size_t>(i)]
+                    = input[pos + static_cast<size_t>(i)] * (0.4f + 0.04f * static_cast<float>(lane));
+
+        for (int lane = 0; lane < numLanes; ++lane)
+        {
+            auto& referenceReverb = references[static_cast<size_t>(lane)];
+            const auto& setting = reverbSettings[lane % numSettings];
+            for (int i = 0; i < n; ++i)
+            {
+                referenceReverb.setParameters(setting.decay, setting.shimmer, setting.size, 0.0f);
+                out.reference.push_back(referenceReverb.process(laneBuffers[static_cast<size_t>(lane)][static_cast<size_t>(i)]));
+            }
+        }
+
+        batch.process(inputs.data(), outputs.data(), n);
+
+        for (int lane = 0; lane < numLanes; ++lane)
+            out.optimised.insert(out.optimised.end(), laneBuffers[static_cast<size_t>(lane)].begin(),
+                                 laneBuffers[static_cast<size_t>(lane)].begin() + n);
+    }
+    return out;
+}
+
+RenderPair renderWavefolder(const Signal& input, double sampleRate)
+{
+    RenderPair out;
+    for (const float fold : { 0.3f, 1.0f })
+    {
+        reference::Wavefolder referenceFolder;
+        Wavefolder folder;
+        referenceFolder.prepare(sampleRate);
+        folder.prepare(sampleRate);
+        referenceFolder.setFold(fold);
+        folder.setFold(fold);
+
+        for (const float x : input)
+        {
+            out.reference.push_back(referenceFolder.process(x));
+            out.optimised.push_back(folder.process(x));
+        }
+    }
+    return out;
+}
+
+RenderPair renderLofi(const Signal& input, double sampleRate)
+{
+    RenderPair out;
+    for (const float degrade : { 0.4f, 0.9f })
+    {
+        reference::LofiDegrader referenceDegrader;
+        LofiDegrader degrader;
+        referenceDegrader.prepare(sampleRate);
+        degrader.prepare(sampleRate);
+        referenceDegrader.setDegrade(degrade);
+        degrader.setDegrade(degrade);
+
+        for (const float x : input)
+        {
+            out.reference.push_back(referenceDegrader.process(x));
+            out.optimised.push_back(degrader.process(x));
+        }
+    }
+    return out;
+}
+
+// Whole chain: drive, freeze gate, reverbs, duck, mix and the metering
+// kernels. The meters are appended to the audio so they are checked too.
+// The FDN reads fractional taps with linear interpolation and has no DC
+// blockers, as the reference, and the loop stays linear: BURN is 0 and the input comes in 26 dB
+// down, so the energy governor and the safety saturator never engage, up
+// to 192 kHz (they are checked separately). What is left must match per
+// sample.
+RenderPair renderEngine(const Signal& input, double sampleRate)
+{
+    reference::CinderEngine referenceEngine;
+    CinderEngine engine;
+    engine.setIntegerTaps(false);
+    engine.setDcBlocking(false);
+    engine.setDelayInterpolation(DelayBuffer::Interpolation::linear);
+    referenceEngine.prepare(sampleRate, blockSize);
+    engine.prepare(sampleRate, blockSize);
+
+    constexpr float inputGain = 0.05f;
+    const float values[] = { 0.4f, 4.0f, 0.2f, 0.0f, 0.6f, 0.3f, 0.6f, 0.0f };
+    // Band decay stays at its flat default (the reference predates it)
+    for (int p = 0; p < reference::CinderEngine::numParams; ++p)
+    {
+        referenceEngine.setParameter(p, values[p]);
+        engine.setParameter(p, values[p]);
+    }
+
+    RenderPair out;
+    Signal referenceMeters, meters;
+    Signal left(blockSize), right(blockSize), left2(blockSize), right2(blockSize);
+
+    for (size_t pos = 0; pos < input.size(); pos += blockSize)
+    {
+        const int n = static_cast<int>(std::min<size_t>(blockSize, input.size() - pos));
+
+        // Freeze for the middle of the tail
+        const bool frozen = pos > input.size() * 5 / 8 && pos < input.size() * 7 / 8;
+        referenceEngine.setParameter(CinderEngine::freeze, frozen ? 1.0f : 0.0f);
+        engine.setParameter(CinderEngine::freeze, frozen ? 1.0f : 0.0f);
+
+        for (int i = 0; i < n; ++i)
+        {
+            const float x = input[pos + static_cast<size_t>(i)] * inputGain;
+            left[static_cast<size_t>(i)] = left2[static_cast<size_t>(i)] = x;
+            right[static_cast<size_t>(i)] = right2[static_cast<size_t>(i)] = -0.8f * x;
+        }
+
+        const auto referenceBlock = referenceEngine.process(left.data(), right.data(), n);
+        const auto block = engine.process(left2.data(), right2.data(), n);
+
+        out.reference.insert(out.reference.end(), left.begin(), left.begin() + n);
+        out.reference.insert(out.reference.end(), right.begin(), right.begin() + n);
+        out.optimised.insert(out.optimised.end(), left2.begin(), left2.begin() + n);
+        out.optimised.insert(out.optimised.end(), right2.begin(), right2.begin() + n);
+
+        referenceMeters.insert(referenceMeters.end(), { referenceBlock.reverbPeak, referenceBlock.outputRms, referenceBlock.outputPeak });
+        meters.insert(meters.end(), { block.reverbPeak, block.outputRms, block.outputPeak });
+    }
+
+    out.reference.insert(out.reference.end(), referenceMeters.begin(), referenceMeters.end());
+    out.optimised.insert(out.optimised.end(), meters.begin(), meters.end());
+    return out;
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    Settings settings;
+    if (! parseArgs(argc, argv, settings))
+    {
+        std::fprintf(stderr, "usage: CinderVerify [--seconds S] [--rate R] [--simd all|generic|avx2|avx512]\n");
+        return 1;
+    }
+
+    // As in a host: denormals flushed on the processing thread
+    FlushDenormals noDenormals;
+
+    const auto signals = makeSignals(settings);
+    const double rate = settings.sampleRate;
+
+    // Scalar kernels: exact ports of the reference, allowed float rounding only
+    constexpr Tolerance exact { 1.0e-6, 1.0e-7, 0.01, 0.01 };
+    // Batch reverb: control-rate parameters and a Pade tanh
+    constexpr Tolerance batchReverb { 2.0e-3, 1.0e-4, 0.1, 0.1 };
+    // Whole chain with the reference's fractional taps and a linear loop: float rounding
+    constexpr Tolerance engineTolerance { 1.0e-5, 1.0e-6, 0.01, 0.01 };
+    constexpr double any = 1.0e30;
+    // Driven loop: the reference saturates every line, the energy governor
+    // turns the loop gain down instead. The tails decorrelate, so only their
+    // short-term level and band spectra are held to the reference (measured
+    // worst ~2.1 dB for both, at 44.1 to 192 kHz).
+    constexpr Tolerance governedTail { any, any, 3.0, 3.0 };
+    // 16-bit delay memory: white quantisation noise ~70 dB below the tail.
+    // Close per sample, but it fills the damped top bands, so the spectral
+    // bound is the decorrelated one.
+    constexpr Tolerance packedMemory { 5.0e-3, 5.0e-4, 2.0, 0.1 };
+
+    constexpr auto half = SampleStorage::float16;
+    constexpr auto fixed = SampleStorage::int16;
+
+    std::vector<Check> scalarChecks {
+        { "shimmer",          exact,         [rate](const Signal& x) { return renderShimmer(x, rate, linearSettings, linearInputGain, false); } },
+        { "shimmer-governed", governedTail,  [rate](const Signal& x) { return renderShimmer(x, rate, governedSettings, 1.0f, true); } },
+        { "shimmer-f16",   packedMemory,     [rate](const Signal& x) { return renderShimmerStorage(x, rate, half); } },
+        { "shimmer-i16",   packedMemory,     [rate](const Signal& x) { return renderShimmerStorage(x, rate, fixed); } },
+        { "wavefolder",    exact,            [rate](const Signal& x) { return renderWavefolder(x, rate); } },
+        { "lofi",          exact,            [rate](const Signal& x) { return renderLofi(x, rate); } },
+    };
+
+    std::vector<Check> simdChecks {
+        { "shimmer-batch",     batchReverb,      [rate](const Signal& x) { return renderShimmerBatch(x, rate); } },
+        { "shimmer-batch-f16", packedMemory,     [rate](const Signal& x) { return renderShimmerBatch(x, rate, half); } },
+        { "shimmer-batch-i16", packedMemory,     [rate](const Signal& x) { return renderShimmerBatch(x, rate, fixed); } },
+        { "engine",            engineTolerance,  [rate](const Signal& x) { return renderEngine(x, rate); } },
+    };
+
+    std::printf("%.0f Hz, %.1f s per signal, detected %s\n", rate, settings.seconds,
+                getSimdLevelName(detectSimdLevel()));
+    std::printf("%-24s %-9s %11s %11s %9s %9s\n", "kernel", "signal", "max abs", "rms", "spec dB", "level dB");
+
+    int failures = 0;
+    auto runCheck = [&](const Check& check, const std::string& label) {
+        for (const auto& signal : signals)
+        {
+            const auto pair = check.render(signal.samples);
+            const auto errors = compare(pair.reference, pair.optimised, rate);
+            const bool pass = pair.reference.size() == pair.optimised.size() && pair.covered
+                              && withinTolerance(errors, check.tolerance);
+            failures += pass ? 0 : 1;
+
+            std::printf("%-24s %-9s %11.3e %11.3e %9.4f %9.4f  %s\n", label.c_str(), signal.name,
+                        errors.maxAbs, errors.rms, errors.spectralDb, errors.levelDb,
+                        pass ? "ok" : (pair.covered ? "FAIL" : "FAIL (regime not reached)"));
+        }
+    };
+
+    for (const auto& check : scalarChecks)
+        runCheck(check, check.name);
+
+    bool ranAny = false;
+    for (auto level : { SimdLevel::generic, SimdLevel::avx2, SimdLevel::avx512 })
+    {
+        const std::string name = getSimdLevelName(level);
+        if (settings.simd != "all" && settings.simd != name)
+            continue;
+
+        if (! forceSimdLevel(level))
+        {
+            std::printf("%-24s not supported on this CPU\n", name.c_str());
+            continue;
+        }
+
+        for (const auto& check : simdChecks)
+            runCheck(check, check.name + " [" + name + "]");
+        ranAny = true;
+    }
+    clearForcedSimdLevel();
+
+    if (failures > 0)
+        std::printf("%d check(s) FAILED\n", failures);
+    else
+        std::printf("all checks passed\n");
+
+    return (failures == 0 && ranAny) ? 0 : 1;
+}
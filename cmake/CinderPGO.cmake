@@ -0,0 +1,59 @@
+# Profile-guided optimisation for the Cinder targets
+#
+#   -DCINDER_PGO=GENERATE   build instrumented binaries that write profiles
+#   -DCINDER_PGO=USE        rebuild optimised with the collected profiles
+#
+# Profiles go to CINDER_PGO_DIR (GCC .gcda / Clang .profraw), or next to each
+# binary for MSVC (.pgd / .pgc). MSVC profiles are per binary, so the training
+# run must load the real Cinder.vst3 and run the real CinderSweep (see pgo.bat
+# and Tools/Train). Clang's .profraw files must be merged into
+# ${CINDER_PGO_DIR}/cinder.profdata with llvm-profdata before the USE build.
+
+set(CINDER_PGO "OFF" CACHE STRING "Profile-guided optimisation phase: OFF, GENERATE or USE")
+set_property(CACHE CINDER_PGO PROPERTY STRINGS OFF GENERATE USE)
+set(CINDER_PGO_DIR "${CMAKE_BINARY_DIR}/pgo" CACHE PATH "Where GCC/Clang profiles are written and read")
+
+function(cinder_enable_pgo target)
+    if(CINDER_PGO STREQUAL "OFF" OR NOT TARGET ${target})
+        return()
+    endif()
+
+    if(MSVC)
+        # PGO on MSVC needs whole-program optimisation (/GL + /LTCG)
+        target_compile_options(${target} PRIVATE /GL)
+        if(CINDER_PGO STREQUAL "GENERATE")
+            target_link_options(${target} PRIVATE /LTCG /GENPROFILE:EXACT)
+        else()
+            target_link_options(${target} PRIVATE /LTCG /USEPROFILE)
+        endif()
+    elseif(CMAKE_CXX_COMPILER_ID MATCHES "Clang")
+        if(CINDER_PGO STREQUAL "GENERATE")
+            target_compile_options(${target} PRIVATE -fprofile-generate=${CINDER_PGO_DIR} -fprofile-update=atomic)
+            target_link_options(${target} PRIVATE -fprofile-generate=${CINDER_PGO_DIR})
+        else()
+            target_compile_options(${target} PRIVATE -fprofile-use=${CINDER_PGO_DIR}/cinder.profdata
+                                                     -Wno-profile-instr-unprofiled -Wno-profile-instr-out-of-date)
+            target_link_options(${target} PRIVATE -fprofile-use=${CINDER_PGO_DIR}/cinder.profdata)
+        endif()
+    elseif(CMAKE_CXX_COMPILER_ID STREQUAL "GNU")
+        if(CINDER_PGO STREQUAL "GENERATE")
+            # Atomic counters: CinderSweep trains on several threads at once
+            target_compile_options(${target} PRIVATE -fprofile-generate=${CINDER_PGO_DIR} -fprofile-update=atomic)
+            target_link_options(${target} PRIVATE -fprofile-generate=${CINDER_PGO_DIR})
+        else()
+            # Code the workload never reached keeps its normal optimisation
+            target_compile_options(${target} PRIVATE -fprofile-use=${CINDER_PGO_DIR} -fprofile-partial-training
+                                                     -Wno-missing-profile)
+        endif()
+    else()
+        message(WARNING "CINDER_PGO: unsupported compiler ${CMAKE_CXX_COMPILER_ID}, ${target} built without PGO")
+    endif()
+endfunction()
+
+if(NOT CINDER_PGO STREQUAL "OFF")
+    if(NOT CINDER_PGO MATCHES "^(GENERATE|USE)$")
+        message(FATAL_ERROR "CINDER_PGO must be OFF, GENERATE or USE (got '${CINDER_PGO}')")
+    endif()
+    file(MAKE_DIRECTORY ${CINDER_PGO_DIR})
+    message(STATUS "Cinder PGO: ${CINDER_PGO} (${CINDER_PGO_DIR})")
+endif()
@@ -0,0 +1,63 @@
+@echo off
+echo ===================================
+echo  Cinder PGO Build Script
+echo ===================================
+echo.
+echo Run this from an "x64 Native Tools Command Prompt" so the
+echo instrumented binaries can find the PGO runtime (pgort140.dll).
+echo.
+
+set BUILD_DIR=build-pgo
+set CONFIG=Release
+set TOOLS_DIR=%BUILD_DIR%\Tools
+set PLUGIN_PATH=%BUILD_DIR%\Cinder_artefacts\%CONFIG%\VST3\Cinder.vst3
+set TRAIN_EXE=%TOOLS_DIR%\CinderTrain_artefacts\%CONFIG%\CinderTrain.exe
+set SWEEP_EXE=%TOOLS_DIR%\CinderSweep_artefacts\%CONFIG%\CinderSweep.exe
+set TRAIN_DATA=%BUILD_DIR%\pgo-training
+
+:: 1. Instrumented build
+cmake -B %BUILD_DIR% -G "Visual Studio 18 2026" -A x64 -DCINDER_BUILD_TOOLS=ON -DCINDER_PGO=GENERATE
+if %ERRORLEVEL% neq 0 goto :failed
+cmake --build %BUILD_DIR% --config %CONFIG%
+if %ERRORLEVEL% neq 0 goto :failed
+
+:: 2. Training workload: plugin (audio + editor), then the CLI renderer
+echo.
+echo Training the plugin...
+"%TRAIN_EXE%" --plugin "%PLUGIN_PATH%"
+if %ERRORLEVEL% neq 0 goto :failed
+
+echo.
+echo Training CinderSweep...
+if exist "%TRAIN_DATA%" rmdir /S /Q "%TRAIN_DATA%"
+"%TRAIN_EXE%" --write-sweep-input "%TRAIN_DATA%\input"
+if %ERRORLEVEL% neq 0 goto :failed
+"%SWEEP_EXE%" --spec Tools\Train\TrainingSweep.json --input "%TRAIN_DATA%\input" --out "%TRAIN_DATA%\output"
+if %ERRORLEVEL% neq 0 goto :failed
+
+:: 3. Optimised rebuild from the collected profiles
+echo.
+echo Rebuilding with profiles...
+cmake -B %BUILD_DIR% -DCINDER_PGO=USE
+if %ERRORLEVEL% neq 0 goto :failed
+cmake --build %BUILD_DIR% --config %CONFIG%
+if %ERRORLEVEL% neq 0 goto :failed
+
+echo.
+echo ===================================
+echo  PGO BUILD SUCCESSFUL!
+echo ===================================
+echo.
+echo Plugin location:
+echo   %PLUGIN_PATH%
+echo Renderer:
+echo   %SWEEP_EXE%
+echo.
+pause
+exit /b 0
+
+:failed
+echo.
+echo ERROR: PGO build failed!
+pause
+exit /b 1